@@ -0,0 +1,243 @@
+// C++ layer benchmark: include/bds++ against the standard library.
+//
+//   make bench                                   (builds with MODE=release)
+//   make bench BENCH_ARGS="--sizes 1000,1000000 --format csv"
+//
+// Each case reports the best wall time of --reps runs as ns/element, for
+// the bds++ template and its std counterpart on the same input:
+//   sort         bds::sort vs std::sort                 (ints, 8-byte records)
+//   stable_sort  bds::stable_sort vs std::stable_sort   (8-byte records)
+//   heap         bds::heap vs std::priority_queue       (n pushes, then n pops)
+//   list_sort    bds::list::sort vs std::list::sort     (8-byte records)
+//
+// Shares BENCH_ARGS with bench_sort, so options meant only for it
+// (--sorts, --dist, ...) are skipped here.
+
+#include "../include/bds++/bds.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <queue>
+#include <string>
+#include <vector>
+
+// ======================================================
+// Payload and input
+// ======================================================
+
+struct Record {
+    int key;
+    int seq;
+};
+
+static const auto record_key = bds::by_key([](const Record &r) { return r.key; });
+static const auto record_less = [](const Record &a, const Record &b) { return a.key < b.key; };
+
+static std::vector<int> random_keys(const std::size_t n) {
+    std::vector<int> keys(n);
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    for (int &key : keys) {
+        // xorshift64*, same generator as bench_sort
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        key = static_cast<int>(static_cast<std::uint32_t>((state * 2685821657736338717ull) >> 32) >> 1);
+    }
+
+    return keys;
+}
+
+// ======================================================
+// Timing
+// ======================================================
+
+// Best of `reps` runs of setup() + run(), timing run() only, in ns/element
+template <class Setup, class Run>
+static double best_ns_per_elem(const std::size_t n, const int reps, Setup setup, Run run) {
+    double best = 0.0;
+
+    for (int rep = 0; rep < reps; ++rep) {
+        setup();
+
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto stop = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(n);
+        if (rep == 0 || ns < best) best = ns;
+    }
+
+    return best;
+}
+
+struct BenchOptions {
+    std::vector<std::size_t> sizes = { 1000, 100000, 1000000 };
+    int reps = 3;
+    bool csv = false;
+};
+
+static bool parse_options(const int argc, char **argv, BenchOptions &options) {
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp(arg, "--sizes") == 0 && value) {
+            options.sizes.clear();
+            for (const char *cursor = value; *cursor;) {
+                char *end = nullptr;
+                const unsigned long long size = std::strtoull(cursor, &end, 10);
+                if (end == cursor || size == 0) return false;
+
+                options.sizes.push_back(static_cast<std::size_t>(size));
+                cursor = *end == ',' ? end + 1 : end;
+            }
+            ++i;
+        } else if (std::strcmp(arg, "--reps") == 0 && value) {
+            options.reps = std::atoi(value);
+            if (options.reps < 1) return false;
+            ++i;
+        } else if (std::strcmp(arg, "--format") == 0 && value) {
+            options.csv = std::strcmp(value, "csv") == 0;
+            ++i;
+        } else if (value && value[0] != '-') {
+            ++i;  // another bench's option and its value
+        }
+    }
+
+    return true;
+}
+
+// ======================================================
+// Cases
+// ======================================================
+
+struct Result {
+    const char *name;
+    const char *payload;
+    std::size_t n;
+    double bds_ns;
+    double std_ns;
+    bool ok;
+};
+
+static std::vector<Result> run_cases(const std::size_t n, const int reps) {
+    std::vector<Result> results;
+    const std::vector<int> keys = random_keys(n);
+
+    std::vector<Record> records(n);
+    for (std::size_t i = 0; i < n; ++i) records[i] = { keys[i] % 1000, static_cast<int>(i) };
+
+    // sort, ints
+    {
+        bds::array<int> values;
+        for (const int key : keys) values.push_back(key);
+        std::vector<int> reference = keys;
+
+        Result result = { "sort", "int", n, 0.0, 0.0, true };
+        result.bds_ns = best_ns_per_elem(n, reps, [&] { std::copy(keys.begin(), keys.end(), values.begin()); }, [&] { values.sort(); });
+        result.std_ns = best_ns_per_elem(n, reps, [&] { reference = keys; }, [&] { std::sort(reference.begin(), reference.end()); });
+        result.ok = std::equal(values.begin(), values.end(), reference.begin(), reference.end());
+        results.push_back(result);
+    }
+
+    // sort and stable_sort, records with duplicate keys
+    {
+        std::vector<Record> ours = records;
+        std::vector<Record> theirs = records;
+
+        Result result = { "sort", "record", n, 0.0, 0.0, true };
+        result.bds_ns = best_ns_per_elem(n, reps, [&] { ours = records; }, [&] { bds::sort(ours.begin(), ours.end(), record_key); });
+        result.std_ns = best_ns_per_elem(n, reps, [&] { theirs = records; }, [&] { std::sort(theirs.begin(), theirs.end(), record_less); });
+        result.ok = std::is_sorted(ours.begin(), ours.end(), record_less);
+        results.push_back(result);
+
+        Result stable = { "stable_sort", "record", n, 0.0, 0.0, true };
+        stable.bds_ns = best_ns_per_elem(n, reps, [&] { ours = records; }, [&] { bds::stable_sort(ours.begin(), ours.end(), record_key); });
+        stable.std_ns = best_ns_per_elem(n, reps, [&] { theirs = records; }, [&] { std::stable_sort(theirs.begin(), theirs.end(), record_less); });
+        stable.ok = std::equal(ours.begin(), ours.end(), theirs.begin(), theirs.end(),
+                               [](const Record &a, const Record &b) { return a.key == b.key && a.seq == b.seq; });
+        results.push_back(stable);
+    }
+
+    // heap: n pushes then n pops
+    {
+        std::int64_t ours_sum = 0;
+        std::int64_t theirs_sum = 0;
+
+        Result result = { "heap", "int", n, 0.0, 0.0, true };
+        result.bds_ns = best_ns_per_elem(n, reps, [&] { ours_sum = 0; }, [&] {
+            bds::heap<int> heap;
+            for (const int key : keys) heap.push(key);
+            for (int previous = heap.top(); !heap.empty(); heap.pop()) {
+                if (heap.top() > previous) result.ok = false;
+                previous = heap.top();
+                ours_sum += previous;
+            }
+        });
+        result.std_ns = best_ns_per_elem(n, reps, [&] { theirs_sum = 0; }, [&] {
+            std::priority_queue<int> heap;
+            for (const int key : keys) heap.push(key);
+            for (; !heap.empty(); heap.pop()) theirs_sum += heap.top();
+        });
+        result.ok = result.ok && ours_sum == theirs_sum;
+        results.push_back(result);
+    }
+
+    // list sort, records
+    {
+        bds::list<Record> ours;
+        std::list<Record> theirs;
+
+        Result result = { "list_sort", "record", n, 0.0, 0.0, true };
+        result.bds_ns = best_ns_per_elem(n, reps, [&] { ours = bds::list<Record>(); for (const Record &r : records) ours.push_back(r); },
+                                         [&] { ours.sort(record_key); });
+        result.std_ns = best_ns_per_elem(n, reps, [&] { theirs.assign(records.begin(), records.end()); },
+                                         [&] { theirs.sort(record_less); });
+        result.ok = std::equal(ours.begin(), ours.end(), theirs.begin(), theirs.end(),
+                               [](const Record &a, const Record &b) { return a.key == b.key && a.seq == b.seq; });
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+// ======================================================
+// main
+// ======================================================
+
+int main(int argc, char **argv) {
+    BenchOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::fprintf(stderr, "usage: %s [--sizes N[,N...]] [--reps N] [--format table|csv]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options.csv) std::printf("case,payload,n,bds_ns_per_elem,std_ns_per_elem,ratio,ok\n");
+    else std::printf("%-12s %-7s %10s %12s %12s %7s  %s\n", "case", "payload", "n", "bds ns/el", "std ns/el", "ratio", "ok");
+
+    bool all_ok = true;
+
+    for (const std::size_t n : options.sizes) {
+        for (const Result &result : run_cases(n, options.reps)) {
+            const double ratio = result.bds_ns / result.std_ns;
+            all_ok = all_ok && result.ok;
+
+            if (options.csv) {
+                std::printf("%s,%s,%zu,%.3f,%.3f,%.3f,%d\n", result.name, result.payload, result.n,
+                            result.bds_ns, result.std_ns, ratio, result.ok);
+            } else {
+                std::printf("%-12s %-7s %10zu %12.2f %12.2f %7.2f  %s\n", result.name, result.payload, result.n,
+                            result.bds_ns, result.std_ns, ratio, result.ok ? "yes" : "MISMATCH");
+            }
+        }
+    }
+
+    return all_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,541 @@
+// Sorting benchmark: every Array sort × sizes × input distributions.
+//
+//   make bench                                   (builds with MODE=release)
+//   make bench BENCH_ARGS="--sizes 1000,1000000 --dist random,sorted --format csv"
+//
+// For each (sort, distribution, size) it reports the best wall time of
+// --reps runs as ns/element, plus key() calls per element from one extra
+// counted run (kept out of the timed runs, so counting costs nothing).
+// qsort() over the same pointers is the baseline. Every result is
+// checked; a sort that leaves the array unsorted makes the run fail.
+//
+// With `make bench STATS=1` the counted run also reports compares, swaps and
+// writes per element (BDS_STATS counters; calling thread only, so parallel
+// sorts show just their serial part). Otherwise those columns are empty.
+// The qsort() baseline is outside the library, so its columns read n/a.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/bds/array/bds_array.h"
+#include "../include/bds/bds_stats.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// ======================================================
+// Payload and key functions
+// ======================================================
+
+typedef struct BenchItem {
+    int key;
+    int seq;  // original position, to check stability
+} BenchItem;
+
+static int key_item(const void *elem) {
+    return ((const BenchItem *)elem)->key;
+}
+
+// Parallel sorts call key() from several threads
+static atomic_size_t g_key_calls;
+
+static int key_item_counted(const void *elem) {
+    atomic_fetch_add_explicit(&g_key_calls, 1, memory_order_relaxed);
+    return ((const BenchItem *)elem)->key;
+}
+
+// qsort() baseline: same pointers, same key function
+static key_val_func g_qsort_key;
+
+static int qsort_compare(const void *a, const void *b) {
+    const int key_a = g_qsort_key(*(void *const *)a);
+    const int key_b = g_qsort_key(*(void *const *)b);
+
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+// ======================================================
+// Sorts under test
+// ======================================================
+
+static void sort_qsort(Array *array, key_val_func key) {
+    g_qsort_key = key;
+    qsort(array->data, arrayLength(array), sizeof(void *), qsort_compare);
+}
+
+static void sort_intro_cached(Array *array, key_val_func key) { arrayIntroSortCached(array, key); }
+static void sort_tim_cached(Array *array, key_val_func key) { arrayTimSortCached(array, key); }
+static void sort_parallel_merge(Array *array, key_val_func key) { arrayParallelMergeSort(array, key, 0); }
+static void sort_parallel_intro(Array *array, key_val_func key) { arrayParallelIntroSort(array, key, 0); }
+static void sort_parallel_oe(Array *array, key_val_func key) { arrayParallelOddEvenSort(array, key, 0); }
+static void sort_parallel_oe_blk(Array *array, key_val_func key) { arrayParallelBlockOddEvenSort(array, key, 0); }
+static void sort_adaptive(Array *array, key_val_func key) { arraySort(array, key, BDS_SORT_DEFAULT); }
+static void sort_adaptive_stable(Array *array, key_val_func key) { arraySort(array, key, BDS_SORT_STABLE); }
+
+typedef struct BenchSort {
+    const char *name;
+    array_sort_func sort;
+    bool quadratic;  // skipped above --max-quadratic
+    bool stable;
+} BenchSort;
+
+static const BenchSort g_sorts[] = {
+    { "qsort",          sort_qsort,              false, false },
+    { "bubble",         arrayBubbleSort,         true,  true  },
+    { "insertion",      arrayInsertionSort,      true,  true  },
+    { "selection",      arraySelectionSort,      true,  false },
+    { "cocktail",       arrayCocktailShakerSort, true,  true  },
+    { "gnome",          arrayGnomeSort,          true,  true  },
+    { "odd_even",       arrayOddEvenSort,        true,  true  },
+    { "comb",           arrayCombSort,           false, false },
+    { "shell",          arrayShellSort,          false, false },
+    { "merge",          arrayMergeSort,          false, true  },
+    { "bottom_up",      arrayBottomUpMergeSort,  false, true  },
+    { "tim",            arrayTimSort,            false, true  },
+    { "block_merge",    arrayBlockMergeSort,     false, true  },
+    { "intro",          arrayIntroSort,          false, false },
+    { "pdq",            arrayPdqSort,            false, false },
+    { "quick",          arrayQuickSort,          false, false },
+    { "radix",          arrayRadixSort,          false, true  },
+    { "intro_cached",   sort_intro_cached,       false, false },
+    { "tim_cached",     sort_tim_cached,         false, true  },
+    { "parallel_merge", sort_parallel_merge,     false, true  },
+    { "parallel_intro", sort_parallel_intro,     false, false },
+    { "parallel_oe",    sort_parallel_oe,        true,  true  },
+    { "parallel_oe_blk", sort_parallel_oe_blk,   false, true  },
+    { "sort",           sort_adaptive,           false, false },
+    { "sort_stable",    sort_adaptive_stable,    false, true  },
+};
+
+#define SORT_COUNT (sizeof(g_sorts) / sizeof(g_sorts[0]))
+
+// ======================================================
+// Input distributions
+// ======================================================
+
+static uint64_t g_rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint32_t bench_rand(void) {
+    // xorshift64*
+    g_rng_state ^= g_rng_state >> 12;
+    g_rng_state ^= g_rng_state << 25;
+    g_rng_state ^= g_rng_state >> 27;
+    return (uint32_t)((g_rng_state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+static void fill_random(BenchItem *items, const size_t n) {
+    for (size_t i = 0; i < n; i++) items[i].key = (int)(bench_rand() >> 1);
+}
+
+static void fill_sorted(BenchItem *items, const size_t n) {
+    for (size_t i = 0; i < n; i++) items[i].key = (int)i;
+}
+
+static void fill_reversed(BenchItem *items, const size_t n) {
+    for (size_t i = 0; i < n; i++) items[i].key = (int)(n - i);
+}
+
+static void fill_organ_pipe(BenchItem *items, const size_t n) {
+    for (size_t i = 0; i < n; i++) items[i].key = (int)(i < n / 2 ? i : n - i);
+}
+
+static void fill_few_unique(BenchItem *items, const size_t n) {
+    for (size_t i = 0; i < n; i++) items[i].key = (int)(bench_rand() % 16u);
+}
+
+static void fill_sawtooth(BenchItem *items, const size_t n) {
+    const size_t tooth = n / 16 > 0 ? n / 16 : 1;
+    for (size_t i = 0; i < n; i++) items[i].key = (int)(i % tooth);
+}
+
+static void fill_perturbed(BenchItem *items, const size_t n) {
+    fill_sorted(items, n);
+
+    // 1% of the positions swapped with a random partner
+    for (size_t s = 0; s < n / 100; s++) {
+        const size_t a = bench_rand() % n;
+        const size_t b = bench_rand() % n;
+        const int temp = items[a].key;
+        items[a].key = items[b].key;
+        items[b].key = temp;
+    }
+}
+
+typedef struct BenchDist {
+    const char *name;
+    void (*fill)(BenchItem *items, size_t n);
+} BenchDist;
+
+static const BenchDist g_dists[] = {
+    { "random",     fill_random     },
+    { "sorted",     fill_sorted     },
+    { "reversed",   fill_reversed   },
+    { "organ_pipe", fill_organ_pipe },
+    { "few_unique", fill_few_unique },
+    { "sawtooth",   fill_sawtooth   },
+    { "perturbed",  fill_perturbed  },
+};
+
+#define DIST_COUNT (sizeof(g_dists) / sizeof(g_dists[0]))
+
+// ======================================================
+// Options
+// ======================================================
+
+typedef enum { FORMAT_TABLE, FORMAT_CSV, FORMAT_JSON } BenchFormat;
+
+#define MAX_SIZES 32
+
+typedef struct BenchOptions {
+    size_t sizes[MAX_SIZES];
+    size_t size_count;
+    const char *sorts;  // comma list or NULL (= all)
+    const char *dists;  // comma list or NULL (= all)
+    size_t reps;
+    size_t max_quadratic;
+    BenchFormat format;
+} BenchOptions;
+
+static void print_usage(const char *argv0) {
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --sizes N[,N...]       element counts (default 1000,100000,1000000)\n"
+        "  --sorts a,b,...        subset of sorts (default: all)\n"
+        "  --dist a,b,...         subset of distributions (default: all)\n"
+        "  --reps N               timed runs per case, best is kept (default 3)\n"
+        "  --max-quadratic N      skip O(n^2) sorts above N elements (default 5000)\n"
+        "  --format table|csv|json\n"
+        "  --list                 print sort and distribution names\n",
+        argv0);
+}
+
+// true if `name` is in the comma separated `list` (NULL list = everything)
+static bool in_list(const char *list, const char *name) {
+    if (!list) return true;
+
+    const size_t len = strlen(name);
+
+    for (const char *p = list; *p; ) {
+        const char *end = strchr(p, ',');
+        const size_t item_len = end ? (size_t)(end - p) : strlen(p);
+
+        if (item_len == len && strncmp(p, name, len) == 0) return true;
+        if (!end) break;
+        p = end + 1;
+    }
+
+    return false;
+}
+
+static bool parse_sizes(const char *text, BenchOptions *options) {
+    options->size_count = 0;
+
+    for (const char *p = text; *p; ) {
+        char *end;
+        const unsigned long long value = strtoull(p, &end, 10);
+
+        if (end == p || options->size_count == MAX_SIZES) return false;
+        options->sizes[options->size_count++] = (size_t)value;
+
+        if (*end == '\0') break;
+        if (*end != ',') return false;
+        p = end + 1;
+    }
+
+    return options->size_count > 0;
+}
+
+static bool parse_options(int argc, char **argv, BenchOptions *options) {
+    options->sizes[0] = 1000;
+    options->sizes[1] = 100000;
+    options->sizes[2] = 1000000;
+    options->size_count = 3;
+    options->sorts = NULL;
+    options->dists = NULL;
+    options->reps = 3;
+    options->max_quadratic = 5000;
+    options->format = FORMAT_TABLE;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--list") == 0) {
+            for (size_t s = 0; s < SORT_COUNT; s++) printf("sort %s\n", g_sorts[s].name);
+            for (size_t d = 0; d < DIST_COUNT; d++) printf("dist %s\n", g_dists[d].name);
+            exit(EXIT_SUCCESS);
+        }
+
+        if (!value) return false;
+        i++;
+
+        if (strcmp(arg, "--sizes") == 0) {
+            if (!parse_sizes(value, options)) return false;
+        } else if (strcmp(arg, "--sorts") == 0) {
+            options->sorts = value;
+        } else if (strcmp(arg, "--dist") == 0) {
+            options->dists = value;
+        } else if (strcmp(arg, "--reps") == 0) {
+            options->reps = (size_t)strtoull(value, NULL, 10);
+            if (options->reps == 0) options->reps = 1;
+        } else if (strcmp(arg, "--max-quadratic") == 0) {
+            options->max_quadratic = (size_t)strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "table") == 0) options->format = FORMAT_TABLE;
+            else if (strcmp(value, "csv") == 0) options->format = FORMAT_CSV;
+            else if (strcmp(value, "json") == 0) options->format = FORMAT_JSON;
+            else return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ======================================================
+// Measurement
+// ======================================================
+
+typedef struct BenchResult {
+    double ns_per_elem;
+    double key_calls_per_elem;
+    double compares_per_elem;  // BDS_STATS only
+    double swaps_per_elem;     // BDS_STATS only
+    double writes_per_elem;    // BDS_STATS only
+    bool sorted;
+    bool stable;  // only meaningful for stable sorts
+} BenchResult;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void check_order(const Array *array, BenchResult *result) {
+    result->sorted = true;
+    result->stable = true;
+
+    for (size_t i = 1; i < arrayLength(array); i++) {
+        const BenchItem *prev = (const BenchItem *)arrayGet(array, i - 1);
+        const BenchItem *cur  = (const BenchItem *)arrayGet(array, i);
+
+        if (prev->key > cur->key) result->sorted = false;
+        if (prev->key == cur->key && prev->seq > cur->seq) result->stable = false;
+    }
+}
+
+static BenchResult run_case(
+    const BenchSort *sort,
+    Array *array,
+    void *const *input,
+    const size_t n,
+    const size_t reps
+) {
+    BenchResult result;
+    double best = -1.0;
+
+    for (size_t r = 0; r < reps; r++) {
+        if (n > 0) memcpy(array->data, input, n * sizeof(void *));
+
+        const double start = now_ns();
+        sort->sort(array, key_item);
+        const double elapsed = now_ns() - start;
+
+        if (best < 0.0 || elapsed < best) best = elapsed;
+    }
+
+    check_order(array, &result);
+
+    // One extra, untimed run for the key() call count and the library counters
+    if (n > 0) memcpy(array->data, input, n * sizeof(void *));
+    atomic_store(&g_key_calls, 0);
+    bdsStatsReset();
+    sort->sort(array, key_item_counted);
+    const BdsStats stats = bdsStatsSnapshot();
+
+    const double denominator = n > 0 ? (double)n : 1.0;
+    result.ns_per_elem = best / denominator;
+    result.key_calls_per_elem = (double)atomic_load(&g_key_calls) / denominator;
+    result.compares_per_elem = (double)stats.compares / denominator;
+    result.swaps_per_elem = (double)stats.swaps / denominator;
+    result.writes_per_elem = (double)stats.writes / denominator;
+
+    return result;
+}
+
+// ======================================================
+// Output
+// ======================================================
+
+static bool g_first_json_row = true;
+
+// Library counter column: "-" / empty / null when built without BDS_STATS,
+// "n/a" / empty / null for a sort the counters cannot see
+static void print_counter(const BenchFormat format, const bool counted, const double value) {
+    if (bdsStatsEnabled() && counted) {
+        printf(format == FORMAT_TABLE ? " %10.2f" : format == FORMAT_CSV ? ",%.3f" : ": %.3f", value);
+        return;
+    }
+
+    if (bdsStatsEnabled() && format == FORMAT_TABLE) {
+        printf("        n/a");
+        return;
+    }
+
+    printf("%s", format == FORMAT_TABLE ? "          -" : format == FORMAT_CSV ? "," : ": null");
+}
+
+static void print_header(const BenchFormat format) {
+    switch (format) {
+        case FORMAT_TABLE:
+            printf("%-15s %-11s %10s %12s %12s %10s %10s %10s %s\n",
+                   "sort", "dist", "n", "ns/elem", "keys/elem", "cmps/elem", "swaps/elem", "sets/elem", "ok");
+            break;
+        case FORMAT_CSV:
+            printf("sort,dist,n,ns_per_elem,key_calls_per_elem,compares_per_elem,swaps_per_elem,writes_per_elem,sorted,stable\n");
+            break;
+        case FORMAT_JSON:
+            printf("[\n");
+            break;
+    }
+}
+
+static void print_row(
+    const BenchFormat format,
+    const BenchSort *sort,
+    const BenchDist *dist,
+    const size_t n,
+    const BenchResult *result
+) {
+    const bool stable = sort->stable ? result->stable : false;
+    const bool counted = sort->sort != sort_qsort;
+
+    switch (format) {
+        case FORMAT_TABLE:
+            printf("%-15s %-11s %10zu %12.2f %12.2f",
+                   sort->name, dist->name, n, result->ns_per_elem, result->key_calls_per_elem);
+            break;
+        case FORMAT_CSV:
+            printf("%s,%s,%zu,%.3f,%.3f",
+                   sort->name, dist->name, n, result->ns_per_elem, result->key_calls_per_elem);
+            break;
+        case FORMAT_JSON:
+            printf("%s  {\"sort\": \"%s\", \"dist\": \"%s\", \"n\": %zu, \"ns_per_elem\": %.3f, "
+                   "\"key_calls_per_elem\": %.3f",
+                   g_first_json_row ? "" : ",\n",
+                   sort->name, dist->name, n, result->ns_per_elem, result->key_calls_per_elem);
+            g_first_json_row = false;
+            break;
+    }
+
+    if (format == FORMAT_JSON) printf(", \"compares_per_elem\"");
+    print_counter(format, counted, result->compares_per_elem);
+    if (format == FORMAT_JSON) printf(", \"swaps_per_elem\"");
+    print_counter(format, counted, result->swaps_per_elem);
+    if (format == FORMAT_JSON) printf(", \"writes_per_elem\"");
+    print_counter(format, counted, result->writes_per_elem);
+
+    switch (format) {
+        case FORMAT_TABLE:
+            printf(" %s\n", !result->sorted ? "UNSORTED" : (sort->stable && !result->stable) ? "UNSTABLE" : "yes");
+            break;
+        case FORMAT_CSV:
+            printf(",%d,%d\n", result->sorted, stable);
+            break;
+        case FORMAT_JSON:
+            printf(", \"sorted\": %s, \"stable\": %s}",
+                   result->sorted ? "true" : "false", stable ? "true" : "false");
+            break;
+    }
+
+    fflush(stdout);
+}
+
+static void print_footer(const BenchFormat format) {
+    if (format == FORMAT_JSON) printf("\n]\n");
+}
+
+// ======================================================
+// main
+// ======================================================
+
+int main(int argc, char **argv) {
+    BenchOptions options;
+
+    if (!parse_options(argc, argv, &options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    size_t max_n = 0;
+    for (size_t i = 0; i < options.size_count; i++) {
+        if (options.sizes[i] > max_n) max_n = options.sizes[i];
+    }
+
+    BenchItem *items = (BenchItem *)malloc((max_n > 0 ? max_n : 1) * sizeof(BenchItem));
+    void **input     = (void **)malloc((max_n > 0 ? max_n : 1) * sizeof(void *));
+
+    if (!items || !input) {
+        fprintf(stderr, "bench: out of memory for %zu elements\n", max_n);
+        free(items);
+        free(input);
+        return EXIT_FAILURE;
+    }
+
+    bool all_ok = true;
+    print_header(options.format);
+
+    for (size_t d = 0; d < DIST_COUNT; d++) {
+        const BenchDist *dist = &g_dists[d];
+        if (!in_list(options.dists, dist->name)) continue;
+
+        for (size_t z = 0; z < options.size_count; z++) {
+            const size_t n = options.sizes[z];
+
+            dist->fill(items, n);
+            for (size_t i = 0; i < n; i++) {
+                items[i].seq = (int)i;
+                input[i] = &items[i];
+            }
+
+            Array *array = arrayNew(n);
+            if (!array) {
+                fprintf(stderr, "bench: out of memory for %zu elements\n", n);
+                all_ok = false;
+                continue;
+            }
+
+            for (size_t s = 0; s < SORT_COUNT; s++) {
+                const BenchSort *sort = &g_sorts[s];
+
+                if (!in_list(options.sorts, sort->name)) continue;
+                if (sort->quadratic && n > options.max_quadratic) continue;
+
+                const BenchResult result = run_case(sort, array, input, n, options.reps);
+                print_row(options.format, sort, dist, n, &result);
+
+                if (!result.sorted || (sort->stable && !result.stable)) all_ok = false;
+            }
+
+            arrayFree(array);
+        }
+    }
+
+    print_footer(options.format);
+
+    free(items);
+    free(input);
+
+    if (!all_ok) {
+        fprintf(stderr, "bench: some sorts produced wrong output\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+#!/bin/sh
+# Sort autotuner, run by `make tune`.
+#
+#   sh benches/tune_sort.sh LIB WORK_DIR OUT_HEADER
+#
+# For every parameter in src/internal/bds_tuning.h it rebuilds the one sort
+# that uses it with -D<PARAM>=<candidate>, links it ahead of LIB into
+# bench_sort, and scores the candidate by the sum of bench_sort's ns/element
+# over a few sizes and distributions (lower is better). A candidate has to
+# beat the default by TUNE_MARGIN percent to be kept, so timing noise does
+# not move the thresholds around. The winners go to OUT_HEADER.
+#
+# Environment: CC, CFLAGS (the release flags), TUNE_ARGS (extra bench_sort
+# options, e.g. "--reps 9"), TUNE_MARGIN (default 3).
+
+set -eu
+
+if [ $# -ne 3 ]; then
+    echo "usage: $0 LIB WORK_DIR OUT_HEADER" >&2
+    exit 2
+fi
+
+LIB=$1
+WORK_DIR=$2
+OUT_HEADER=$3
+
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--std=c11 -O2 -DNDEBUG -pthread}
+TUNE_ARGS=${TUNE_ARGS:-}
+TUNE_MARGIN=${TUNE_MARGIN:-3}
+
+DEFAULTS=src/internal/bds_tuning.h
+SORTING=src/array/sorting
+
+mkdir -p "$WORK_DIR" "$(dirname "$OUT_HEADER")"
+
+# The bench driver is the same for every candidate
+$CC -Iinclude -Isrc $CFLAGS -c benches/bench_sort.c -o "$WORK_DIR/bench_sort.o"
+
+default_of() {
+    sed -n "s/^#define $1 \([0-9][0-9]*\).*/\1/p" "$DEFAULTS"
+}
+
+# score SOURCE PARAM VALUE SORT DISTS SIZES -> sum of ns/element, or "fail"
+score() {
+    bin="$WORK_DIR/$2_$3"
+
+    $CC -Iinclude -Isrc $CFLAGS "-D$2=$3" -c "$SORTING/$1" -o "$bin.o"
+    $CC $CFLAGS "$WORK_DIR/bench_sort.o" "$bin.o" "$LIB" -o "$bin"
+
+    # csv: sort,dist,n,ns_per_elem,...,sorted,stable
+    "$bin" --sorts "$4" --dist "$5" --sizes "$6" --reps 5 $TUNE_ARGS --format csv |
+        awk -F, 'NR > 1 { if ($(NF - 1) != 1) bad = 1; sum += $4 }
+                 END    { if (bad || NR < 2) print "fail"; else printf "%.2f\n", sum }'
+}
+
+# tune SOURCE PARAM SORT DISTS SIZES CANDIDATES... -> appends PARAM to the header
+tune() {
+    source=$1 param=$2 sort=$3 dists=$4 sizes=$5
+    shift 5
+
+    default=$(default_of "$param")
+    best=$default
+    best_score=$(score "$source" "$param" "$default" "$sort" "$dists" "$sizes")
+    scores="$default: $best_score"
+
+    if [ "$best_score" = fail ]; then
+        echo "tune: $sort is broken with the default $param=$default" >&2
+        exit 1
+    fi
+
+    threshold=$(echo "$best_score $TUNE_MARGIN" | awk '{ printf "%.2f", $1 * (100 - $2) / 100 }')
+
+    for value in "$@"; do
+        [ "$value" = "$default" ] && continue
+
+        s=$(score "$source" "$param" "$value" "$sort" "$dists" "$sizes")
+        scores="$scores, $value: $s"
+
+        [ "$s" = fail ] && continue
+        if awk -v s="$s" -v t="$threshold" -v b="$best_score" 'BEGIN { exit !(s < t && s < b) }'; then
+            best=$value
+            best_score=$s
+        fi
+    done
+
+    echo "tune: $param = $best  ($scores)" >&2
+
+    {
+        echo
+        echo "// ns/element summed over $sort × {$dists} × {$sizes}: $scores"
+        echo "#ifndef $param"
+        echo "#define $param $best"
+        echo "#endif"
+    } >> "$OUT_HEADER.tmp"
+}
+
+{
+    echo "// Generated by \`make tune\` on $(uname -n), $(date -u '+%Y-%m-%d %H:%M UTC')."
+    echo "// Included by src/internal/bds_tuning.h; \`make untune\` goes back to the defaults."
+    echo
+    echo "#pragma once"
+} > "$OUT_HEADER.tmp"
+
+tune array_quick_sort.c QUICK_LEAF_THRESHOLD quick random,few_unique 1000,100000 8 12 16 24 32 48
+tune array_intro_sort.c INTRO_LEAF_THRESHOLD intro random,few_unique 1000,100000 8 12 16 24 32 48
+tune array_tim_sort.c   TIM_MIN_MERGE        tim   random,perturbed,sawtooth 1000,100000 16 32 64
+tune array_shell_sort.c SHELL_GAP_SEQUENCE   shell random,perturbed 1000,100000 0 1 2
+
+mv "$OUT_HEADER.tmp" "$OUT_HEADER"
+echo "tune: wrote $OUT_HEADER" >&2
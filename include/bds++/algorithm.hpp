@@ -0,0 +1,310 @@
+#pragma once
+
+#include <cstddef>      // std::ptrdiff_t
+#include <functional>   // std::less
+#include <iterator>     // std::iterator_traits, std::make_move_iterator
+#include <type_traits>  // std::is_trivially_copyable_v
+#include <utility>      // std::move, std::iter_swap
+#include <vector>
+
+/// ===============================================================
+/// Sorting and searching templates
+/// ===============================================================
+///
+/// The algorithms of src/array/sorting as templates over random-access
+/// iterators: the comparator is a template parameter, so it inlines,
+/// and elements are moved rather than boxed behind void *. Any
+/// iterator std::sort accepts works here (bds::array, std::vector,
+/// raw pointers). Comparators follow the std convention: comp(a, b)
+/// is true when a goes before b.
+///
+///   bds::sort(v.begin(), v.end());
+///   bds::stable_sort(v.begin(), v.end(), bds::by_key([](const P &p) { return p.x; }));
+/// ===============================================================
+
+namespace bds {
+
+// Comparator from a key function, the C library's key_val_func model
+template <class Key>
+struct key_less {
+    Key key;
+
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return key(a) < key(b); }
+};
+
+template <class Key>
+key_less<Key> by_key(Key key) { return key_less<Key>{ std::move(key) }; }
+
+namespace detail {
+
+// Ranges this short are insertion sorted
+inline constexpr std::ptrdiff_t insertion_threshold = 16;
+
+// Elements cheap enough to copy on every step of a branch-free loop
+template <class T>
+inline constexpr bool branchless_friendly = std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void *);
+
+template <class It>
+using value_t = typename std::iterator_traits<It>::value_type;
+
+// Stable
+template <class It, class Compare>
+void insertion_sort(It first, It last, Compare &comp) {
+    if (first == last) return;
+
+    for (It i = first + 1; i != last; ++i) {
+        value_t<It> item = std::move(*i);
+        It j = i;
+
+        for (; j != first && comp(item, *(j - 1)); --j) *j = std::move(*(j - 1));
+
+        *j = std::move(item);
+    }
+}
+
+/// Binary heap helpers. comp is "less": the root holds the largest element.
+/// Both move a hole instead of swapping, one move per level.
+
+template <class It, class Compare>
+void sift_up(It first, std::ptrdiff_t hole, const std::ptrdiff_t top, value_t<It> value, Compare &comp) {
+    while (hole > top) {
+        const std::ptrdiff_t parent = (hole - 1) / 2;
+        if (!comp(first[parent], value)) break;
+
+        first[hole] = std::move(first[parent]);
+        hole = parent;
+    }
+
+    first[hole] = std::move(value);
+}
+
+// Refills the hole at `hole` with `value`: walks the hole down the larger
+// children to a leaf, then sifts value back up (Floyd; about half the compares)
+template <class It, class Compare>
+void sift_down(It first, std::ptrdiff_t hole, const std::ptrdiff_t length, value_t<It> value, Compare &comp) {
+    const std::ptrdiff_t top = hole;
+    std::ptrdiff_t child = 2 * hole + 2;
+
+    while (child < length) {
+        if (comp(first[child], first[child - 1])) --child;
+
+        first[hole] = std::move(first[child]);
+        hole = child;
+        child = 2 * child + 2;
+    }
+
+    if (child == length) {
+        first[hole] = std::move(first[child - 1]);
+        hole = child - 1;
+    }
+
+    detail::sift_up(first, hole, top, std::move(value), comp);
+}
+
+template <class It, class Compare>
+void make_heap(It first, It last, Compare &comp) {
+    const std::ptrdiff_t length = last - first;
+
+    for (std::ptrdiff_t idx = length / 2; idx > 0; --idx) {
+        value_t<It> value = std::move(first[idx - 1]);
+        detail::sift_down(first, idx - 1, length, std::move(value), comp);
+    }
+}
+
+template <class It, class Compare>
+void heap_sort(It first, It last, Compare &comp) {
+    detail::make_heap(first, last, comp);
+
+    for (std::ptrdiff_t end = last - first - 1; end > 0; --end) {
+        value_t<It> value = std::move(first[end]);
+        first[end] = std::move(first[0]);
+        detail::sift_down(first, 0, end, std::move(value), comp);
+    }
+}
+
+// Partitions (first, last) around the pivot in *first. Returns the end of
+// the left part, which holds the elements before the pivot, or with
+// skip_equal, those not after it. The pivot itself stays in *first.
+template <class It, class Compare>
+It partition(It first, It last, Compare &comp, const bool skip_equal) {
+    using T = value_t<It>;
+    It store = first + 1;
+
+    if constexpr (branchless_friendly<T>) {
+        // Branchless Lomuto: no mispredictions on random keys
+        const T pivot = *first;
+
+        for (It i = first + 1; i != last; ++i) {
+            const T item = *i;
+            const bool left = skip_equal ? !comp(pivot, item) : comp(item, pivot);
+            *i = *store;
+            *store = item;
+            store += left;
+        }
+    } else {
+        for (It i = first + 1; i != last; ++i) {
+            const bool left = skip_equal ? !comp(*first, *i) : comp(*i, *first);
+            if (left) std::iter_swap(i, store++);
+        }
+    }
+
+    return store;
+}
+
+template <class It, class Compare>
+void intro_sort_loop(It first, It last, std::ptrdiff_t depth_limit, bool leftmost, Compare &comp) {
+    while (last - first > insertion_threshold) {
+        if (depth_limit-- == 0) {
+            detail::heap_sort(first, last, comp);
+            return;
+        }
+
+        // Median of three, moved to *first
+        It mid = first + (last - first) / 2;
+        if (comp(*mid, *first)) std::iter_swap(mid, first);
+        if (comp(*(last - 1), *mid)) {
+            std::iter_swap(last - 1, mid);
+            if (comp(*mid, *first)) std::iter_swap(mid, first);
+        }
+        std::iter_swap(first, mid);
+
+        // Not after the element left of the range, so the smallest key here:
+        // move every copy of it left and skip them (pdqsort's trick)
+        const bool skip_equal = !leftmost && !comp(*(first - 1), *first);
+
+        It store = detail::partition(first, last, comp, skip_equal);
+
+        if (skip_equal) {
+            first = store;
+            continue;
+        }
+
+        It split = store - 1;
+        std::iter_swap(first, split);
+
+        // Recurse into the smaller side, loop on the larger: O(log n) stack
+        if (split - first < last - split) {
+            detail::intro_sort_loop(first, split, depth_limit, leftmost, comp);
+            first = split + 1;
+            leftmost = false;
+        } else {
+            detail::intro_sort_loop(split + 1, last, depth_limit, false, comp);
+            last = split;
+        }
+    }
+
+    detail::insertion_sort(first, last, comp);
+}
+
+// Stable merge of src[lo, mid) and src[mid, hi) into dst[lo, hi)
+template <class Src, class Dst, class Compare>
+void merge_runs(Src src, Dst dst, std::ptrdiff_t lo, const std::ptrdiff_t mid, const std::ptrdiff_t hi, Compare &comp) {
+    std::ptrdiff_t left = lo;
+    std::ptrdiff_t right = mid;
+
+    if constexpr (branchless_friendly<value_t<Src>>) {
+        while (left < mid && right < hi) {
+            // Ties take the left element: stable
+            const bool take_right = comp(src[right], src[left]);
+            dst[lo++] = take_right ? src[right] : src[left];
+            right += take_right;
+            left += !take_right;
+        }
+    } else {
+        while (left < mid && right < hi) {
+            if (comp(src[right], src[left])) dst[lo++] = std::move(src[right++]);
+            else dst[lo++] = std::move(src[left++]);
+        }
+    }
+
+    while (left < mid) dst[lo++] = std::move(src[left++]);
+    while (right < hi) dst[lo++] = std::move(src[right++]);
+}
+
+template <class It, class Buffer, class Compare>
+void merge_pass(It src, Buffer dst, const std::ptrdiff_t length, const std::ptrdiff_t width, Compare &comp) {
+    for (std::ptrdiff_t lo = 0; lo < length; lo += 2 * width) {
+        const std::ptrdiff_t mid = lo + width < length ? lo + width : length;
+        const std::ptrdiff_t hi = mid + width < length ? mid + width : length;
+        detail::merge_runs(src, dst, lo, mid, hi, comp);
+    }
+}
+
+}  // namespace detail
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+// IntroSort: not stable, in-place, O(n log n) worst case
+template <class It, class Compare = std::less<>>
+void sort(It first, It last, Compare comp = Compare()) {
+    std::ptrdiff_t depth_limit = 0;
+    for (std::ptrdiff_t n = last - first; n > 1; n >>= 1) depth_limit += 2;
+
+    detail::intro_sort_loop(first, last, depth_limit, true, comp);
+}
+
+// Bottom-up merge sort over a buffer of n elements: stable, O(n log n)
+template <class It, class Compare = std::less<>>
+void stable_sort(It first, It last, Compare comp = Compare()) {
+    const std::ptrdiff_t length = last - first;
+    if (length < 2) return;
+
+    for (It lo = first; lo < last; lo += detail::insertion_threshold) {
+        It hi = last - lo > detail::insertion_threshold ? lo + detail::insertion_threshold : last;
+        detail::insertion_sort(lo, hi, comp);
+    }
+    if (length <= detail::insertion_threshold) return;
+
+    // Buffer takes the elements; the passes then ping-pong between the two
+    std::vector<detail::value_t<It>> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+    bool in_buffer = true;
+
+    for (std::ptrdiff_t width = detail::insertion_threshold; width < length; width *= 2) {
+        if (in_buffer) detail::merge_pass(buffer.begin(), first, length, width, comp);
+        else detail::merge_pass(first, buffer.begin(), length, width, comp);
+
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) std::move(buffer.begin(), buffer.end(), first);
+}
+
+template <class It, class Compare = std::less<>>
+void heap_sort(It first, It last, Compare comp = Compare()) {
+    if (last - first > 1) detail::heap_sort(first, last, comp);
+}
+
+// First position whose element is not before `value` (branchless)
+template <class It, class T, class Compare = std::less<>>
+It lower_bound(It first, It last, const T &value, Compare comp = Compare()) {
+    std::ptrdiff_t length = last - first;
+    if (length == 0) return first;
+
+    while (length > 1) {
+        const std::ptrdiff_t half = length / 2;
+        first = comp(first[half - 1], value) ? first + half : first;
+        length -= half;
+    }
+
+    return first + comp(*first, value);
+}
+
+// First position whose element is after `value` (branchless)
+template <class It, class T, class Compare = std::less<>>
+It upper_bound(It first, It last, const T &value, Compare comp = Compare()) {
+    std::ptrdiff_t length = last - first;
+    if (length == 0) return first;
+
+    while (length > 1) {
+        const std::ptrdiff_t half = length / 2;
+        first = !comp(value, first[half - 1]) ? first + half : first;
+        length -= half;
+    }
+
+    return first + !comp(value, *first);
+}
+
+}  // namespace bds
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "../bds/bds_config.h"
+#include "algorithm.hpp"
+
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <initializer_list>
+#include <memory>            // std::allocator, std::uninitialized_move, std::destroy
+#include <new>               // placement new
+#include <utility>           // std::exchange, std::forward, std::move, std::swap
+
+/// ===============================================================
+/// bds::array<T>
+/// ===============================================================
+///
+/// Growable contiguous array holding T by value (the C Array holds
+/// void *). Iterators are plain pointers, so every std algorithm
+/// accepts them. Grows like the C Stack (bds_config.h). Copying
+/// copies the elements; moving steals the buffer.
+/// ===============================================================
+
+namespace bds {
+
+template <class T>
+class array {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    //// Lifecycle ////
+
+    array() noexcept = default;
+
+    explicit array(const size_type length) {  // value-initialized elements
+        reserve(length);
+        for (; length_ < length; ++length_) ::new (static_cast<void *>(data_ + length_)) T();
+    }
+
+    array(std::initializer_list<T> init) {
+        reserve(init.size());
+        for (const T &value : init) push_back(value);
+    }
+
+    array(const array &other) {
+        reserve(other.length_);
+        for (const T &value : other) push_back(value);
+    }
+
+    array(array &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          length_(std::exchange(other.length_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)) {}
+
+    array &operator=(array other) noexcept {  // copy- and move-assignment
+        swap(other);
+        return *this;
+    }
+
+    ~array() {
+        clear();
+        std::allocator<T>().deallocate(data_, capacity_);
+    }
+
+    void swap(array &other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(length_, other.length_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    //// Info ////
+
+    size_type size() const noexcept { return length_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return length_ == 0; }
+
+    //// Access ////
+
+    T *data() noexcept { return data_; }
+    const T *data() const noexcept { return data_; }
+
+    T &operator[](const size_type index) noexcept { return data_[index]; }
+    const T &operator[](const size_type index) const noexcept { return data_[index]; }
+
+    T &front() noexcept { return data_[0]; }
+    const T &front() const noexcept { return data_[0]; }
+    T &back() noexcept { return data_[length_ - 1]; }
+    const T &back() const noexcept { return data_[length_ - 1]; }
+
+    iterator begin() noexcept { return data_; }
+    iterator end() noexcept { return data_ + length_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + length_; }
+    const_iterator cbegin() const noexcept { return data_; }
+    const_iterator cend() const noexcept { return data_ + length_; }
+
+    //// Change ////
+
+    void reserve(const size_type new_capacity) {
+        if (new_capacity <= capacity_) return;
+
+        std::allocator<T> allocator;
+        T *new_data = allocator.allocate(new_capacity);
+
+        try {
+            std::uninitialized_move(data_, data_ + length_, new_data);
+        } catch (...) {
+            allocator.deallocate(new_data, new_capacity);
+            throw;
+        }
+
+        std::destroy(data_, data_ + length_);
+        allocator.deallocate(data_, capacity_);
+
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args) {
+        if (length_ == capacity_) {
+            // Built first: args may refer to an element that growing moves
+            T value(std::forward<Args>(args)...);
+            reserve(grown_capacity());
+            return *::new (static_cast<void *>(data_ + length_++)) T(std::move(value));
+        }
+
+        return *::new (static_cast<void *>(data_ + length_++)) T(std::forward<Args>(args)...);
+    }
+
+    void push_back(const T &value) { emplace_back(value); }
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    void pop_back() noexcept { data_[--length_].~T(); }
+
+    void clear() noexcept {
+        std::destroy(data_, data_ + length_);
+        length_ = 0;
+    }
+
+    //// Algorithms ////
+
+    template <class Compare = std::less<>>
+    void sort(Compare comp = Compare()) { bds::sort(begin(), end(), comp); }
+
+    template <class Compare = std::less<>>
+    void stable_sort(Compare comp = Compare()) { bds::stable_sort(begin(), end(), comp); }
+
+private:
+    size_type grown_capacity() const noexcept {
+        const size_type grown = static_cast<size_type>(static_cast<double>(capacity_) * (ARRAY_GEOMETRIC_EXPANSION_RATIO + 1.0)) + 1;
+        return grown < ARRAY_MINIMUM_CAPACITY ? ARRAY_MINIMUM_CAPACITY : grown;
+    }
+
+    T *data_ = nullptr;
+    size_type length_ = 0;
+    size_type capacity_ = 0;
+};
+
+template <class T>
+void swap(array<T> &a, array<T> &b) noexcept { a.swap(b); }
+
+}  // namespace bds
@@ -0,0 +1,11 @@
+#pragma once
+
+// Header-only C++17 layer: the library's algorithms as templates, so
+// comparators inline and elements are stored by value.
+
+#include "algorithm.hpp"
+
+#include "array.hpp"
+#include "list.hpp"
+
+#include "heap.hpp"
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "algorithm.hpp"
+#include "array.hpp"
+
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <functional>  // std::less
+#include <utility>     // std::forward, std::move
+
+/// ===============================================================
+/// bds::heap<T, Compare>
+/// ===============================================================
+///
+/// Binary heap over a bds::array<T>, with the same contract as
+/// std::priority_queue: top() is the element that goes last under
+/// Compare (the largest, with the default std::less). Sifts move a
+/// hole instead of swapping, and pop() sifts the hole to a leaf before
+/// placing the tail element (Floyd), which halves its comparisons.
+/// ===============================================================
+
+namespace bds {
+
+template <class T, class Compare = std::less<T>>
+class heap {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+
+    //// Lifecycle ////
+
+    heap() = default;
+
+    explicit heap(const Compare &comp) : comp_(comp) {}
+
+    template <class It>
+    heap(It first, It last, const Compare &comp = Compare()) : comp_(comp) {
+        for (; first != last; ++first) data_.push_back(*first);
+        if (data_.size() > 1) detail::make_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    //// Info ////
+
+    size_type size() const noexcept { return data_.size(); }
+    bool empty() const noexcept { return data_.empty(); }
+
+    //// Access ////
+
+    const T &top() const noexcept { return data_.front(); }
+
+    //// Change ////
+
+    template <class... Args>
+    void emplace(Args &&...args) {
+        data_.emplace_back(std::forward<Args>(args)...);
+
+        const std::ptrdiff_t last = static_cast<std::ptrdiff_t>(data_.size()) - 1;
+        T value = std::move(data_.back());
+        detail::sift_up(data_.begin(), last, 0, std::move(value), comp_);
+    }
+
+    void push(const T &value) { emplace(value); }
+    void push(T &&value) { emplace(std::move(value)); }
+
+    // Removes top()
+    void pop() {
+        T value = std::move(data_.back());
+        data_.pop_back();
+
+        if (!data_.empty()) {
+            detail::sift_down(data_.begin(), 0, static_cast<std::ptrdiff_t>(data_.size()), std::move(value), comp_);
+        }
+    }
+
+    // Removes top() and returns it (works for move-only T)
+    T pop_top() {
+        T top_value = std::move(data_.front());
+        pop();
+        return top_value;
+    }
+
+    void clear() noexcept { data_.clear(); }
+
+private:
+    array<T> data_;
+    Compare comp_;
+};
+
+}  // namespace bds
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <functional>        // std::less
+#include <initializer_list>
+#include <iterator>          // std::forward_iterator_tag
+#include <type_traits>       // std::conditional_t
+#include <utility>           // std::exchange, std::forward, std::move, std::swap
+
+/// ===============================================================
+/// bds::list<T>
+/// ===============================================================
+///
+/// Singly linked list like the C List (head + length), plus a tail
+/// pointer so push_back is O(1). Nodes hold T by value. Iterators are
+/// forward iterators. sort() relinks nodes (stable, no allocation).
+/// ===============================================================
+
+namespace bds {
+
+template <class T>
+class list {
+    struct node {
+        T value;
+        node *next = nullptr;
+
+        template <class... Args>
+        explicit node(Args &&...args) : value(std::forward<Args>(args)...) {}
+    };
+
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        basic_iterator() noexcept = default;
+        explicit basic_iterator(node *current) noexcept : current_(current) {}
+        operator basic_iterator<true>() const noexcept { return basic_iterator<true>(current_); }
+
+        reference operator*() const noexcept { return current_->value; }
+        pointer operator->() const noexcept { return &current_->value; }
+
+        basic_iterator &operator++() noexcept {
+            current_ = current_->next;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator previous = *this;
+            current_ = current_->next;
+            return previous;
+        }
+
+        friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept { return a.current_ == b.current_; }
+        friend bool operator!=(const basic_iterator &a, const basic_iterator &b) noexcept { return a.current_ != b.current_; }
+
+    private:
+        node *current_ = nullptr;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    //// Lifecycle ////
+
+    list() noexcept = default;
+
+    list(std::initializer_list<T> init) {
+        for (const T &value : init) push_back(value);
+    }
+
+    list(const list &other) {
+        for (const T &value : other) push_back(value);
+    }
+
+    list(list &&other) noexcept
+        : head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          length_(std::exchange(other.length_, 0)) {}
+
+    list &operator=(list other) noexcept {  // copy- and move-assignment
+        swap(other);
+        return *this;
+    }
+
+    ~list() { clear(); }
+
+    void swap(list &other) noexcept {
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(length_, other.length_);
+    }
+
+    //// Info ////
+
+    size_type size() const noexcept { return length_; }
+    bool empty() const noexcept { return length_ == 0; }
+
+    //// Access ////
+
+    T &front() noexcept { return head_->value; }
+    const T &front() const noexcept { return head_->value; }
+    T &back() noexcept { return tail_->value; }
+    const T &back() const noexcept { return tail_->value; }
+
+    iterator begin() noexcept { return iterator(head_); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator begin() const noexcept { return const_iterator(head_); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cbegin() const noexcept { return const_iterator(head_); }
+    const_iterator cend() const noexcept { return const_iterator(nullptr); }
+
+    //// Change ////
+
+    template <class... Args>
+    T &emplace_front(Args &&...args) {
+        node *fresh = new node(std::forward<Args>(args)...);
+        fresh->next = head_;
+        head_ = fresh;
+        if (!tail_) tail_ = fresh;
+        ++length_;
+        return fresh->value;
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args) {
+        node *fresh = new node(std::forward<Args>(args)...);
+        if (tail_) tail_->next = fresh;
+        else head_ = fresh;
+        tail_ = fresh;
+        ++length_;
+        return fresh->value;
+    }
+
+    void push_front(const T &value) { emplace_front(value); }
+    void push_front(T &&value) { emplace_front(std::move(value)); }
+    void push_back(const T &value) { emplace_back(value); }
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    void pop_front() noexcept {
+        node *old_head = head_;
+        head_ = head_->next;
+        if (!head_) tail_ = nullptr;
+        --length_;
+        delete old_head;
+    }
+
+    void clear() noexcept {
+        while (head_) delete std::exchange(head_, head_->next);
+        tail_ = nullptr;
+        length_ = 0;
+    }
+
+    //// Algorithms ////
+
+    // Bottom-up merge sort on the links: stable, O(n log n), no allocation
+    template <class Compare = std::less<>>
+    void sort(Compare comp = Compare()) {
+        if (length_ < 2) return;
+
+        // bins[i] holds a sorted run of 2^i nodes, older than those in lower bins
+        node *bins[64] = {};
+        std::size_t used = 0;
+
+        while (head_) {
+            node *run = std::exchange(head_, head_->next);
+            run->next = nullptr;
+
+            std::size_t bin = 0;
+            for (; bin < used && bins[bin]; ++bin) {
+                run = merge(std::exchange(bins[bin], nullptr), run, comp);
+            }
+
+            if (bin == used) ++used;
+            bins[bin] = run;
+        }
+
+        node *sorted = nullptr;
+        for (std::size_t bin = 0; bin < used; ++bin) {
+            if (bins[bin]) sorted = sorted ? merge(bins[bin], sorted, comp) : bins[bin];
+        }
+
+        head_ = sorted;
+        for (tail_ = head_; tail_->next; tail_ = tail_->next) {}
+    }
+
+private:
+    // Stable: on ties, `left` (the older run) goes first
+    template <class Compare>
+    static node *merge(node *left, node *right, Compare &comp) {
+        node *merged = nullptr;
+        node **link = &merged;
+
+        while (left && right) {
+            if (comp(right->value, left->value)) {
+                *link = right;
+                link = &right->next;
+                right = right->next;
+            } else {
+                *link = left;
+                link = &left->next;
+                left = left->next;
+            }
+        }
+
+        *link = left ? left : right;
+        return merged;
+    }
+
+    node *head_ = nullptr;
+    node *tail_ = nullptr;
+    size_type length_ = 0;
+};
+
+template <class T>
+void swap(list<T> &a, list<T> &b) noexcept { a.swap(b); }
+
+}  // namespace bds
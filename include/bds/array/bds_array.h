@@ -4,4 +4,8 @@
 #include "bds_array_find.h"
 #include "bds_array_utils.h"
 #include "bds_array_sort.h"
+#include "bds_array_external.h"
+#include "bds_array_map.h"
+#include "bds_array_pipe.h"
+#include "bds_array_template.h"
 
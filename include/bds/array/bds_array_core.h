@@ -2,6 +2,7 @@
 
 #include "../bds_types.h"
 #include "../bds_utils.h"
+#include "../bds_stats.h"
 
 #include <stddef.h>   // size_t
 #include <stdbool.h>  // bool
@@ -53,10 +54,48 @@ static inline void *arrayLast(const Array *array) {
     return array->data[array->length - 1];
 }
 
+//// Views ////
+///
+/// An ArrayView is an Array value that borrows a window of another Array's
+/// data[]: nothing is copied or allocated. Every function taking an Array *
+/// takes &view, so sorts, finds, binary searches, pipelines and parallel
+/// algorithms all work on just the window, in place. Indexes they return
+/// are relative to the view. Sorting a view permutes the window inside the
+/// parent. Never arrayFree a view; it is invalid once the parent is freed.
+/// Slicing needs a mutable parent; arraySliceConst gives a read-only view
+/// of a const one.
+
+typedef Array ArrayView;
+
+// Read-only view of array[lo, hi): fills *view and returns it as const, for
+// the functions that take a const Array * (finds, searches, pipelines)
+static inline const ArrayView *arraySliceConst(const Array *array, const size_t lo, size_t hi, ArrayView *view) {
+    view->data = NULL;
+    view->length = 0;
+    if (!arrayExists(array)) return view;
+
+    if (hi > array->length) hi = array->length;
+    if (lo >= hi) return view;
+
+    view->data = array->data + lo;
+    view->length = hi - lo;
+
+    return view;
+}
+
+// View of array[lo, hi); hi is clamped to the length, lo > hi gives an empty view
+static inline ArrayView arraySlice(Array *array, const size_t lo, const size_t hi) {
+    ArrayView view;
+    arraySliceConst(array, lo, hi, &view);
+
+    return view;
+}
+
 //// Change ////
 
 // sets array[index] = data
 static inline void arraySet(Array *array, const size_t index, void *data) {
     if (!arrayExists(array) || index >= arrayLength(array)) return;
+    BDS_STATS_ADD(writes, 1);
     array->data[index] = data;
 }
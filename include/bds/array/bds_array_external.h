@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "bds_array_core.h"
+#include "bds_array_sort.h"
+
+//// External sorting ////
+///
+/// Sorts a stream of records that need not fit in memory: reads `in_fd`
+/// in chunks that fit the memory budget, sorts each chunk with an Array
+/// sort, spills it to a temporary file (a "run"), then merges the runs
+/// into `out_fd` with a loser tree. If there are more runs than one merge
+/// can buffer, groups of runs are merged into longer runs first.
+///
+/// Records are either fixed-size (record_size > 0) or length-prefixed
+/// (record_size == 0): a uint32_t byte count in native byte order, then
+/// that many bytes. key() gets a pointer to the record's bytes (after the
+/// prefix). Stable if `sorter` is stable. The default sorter is
+/// arrayParallelMergeSort with `nthreads`, or arraySort(BDS_SORT_STABLE) on
+/// one thread; its key cache counts against the budget.
+///
+/// With more than one thread the budget holds two chunks: one is sorted and
+/// spilled on a worker thread (so a custom sorter runs there) while the
+/// next is read, so reading overlaps sorting and writing.
+///
+/// Both descriptors are read/written sequentially from their current
+/// position; neither is closed. Temporary files are unlinked as soon as
+/// they are created, so nothing is left behind on failure.
+
+typedef struct bds_external_sort_config {
+    size_t record_size;       // Bytes per record; 0 = length-prefixed records
+    size_t memory_budget;     // Bytes for chunks and I/O buffers; 0 = EXTERNAL_SORT_DEFAULT_BUDGET
+    array_sort_func sorter;   // Sorts each in-memory chunk; NULL = arrayParallelMergeSort, or stable arraySort on one thread
+    const char *temp_dir;     // Where runs are spilled; NULL = $TMPDIR, else /tmp
+    size_t nthreads;          // Chunk sorting and read overlap; 0 = every online CPU, 1 = calling thread only
+} ExternalSortConfig;
+
+// config == NULL: length-prefixed records and every default.
+// false on I/O error, truncated input, a record larger than the budget, or OOM.
+bool arrayExternalSort(int in_fd, int out_fd, key_val_func key, const ExternalSortConfig *config);
@@ -14,3 +14,56 @@ size_t arrayMinIdx(const Array *array, key_val_func key);
 
 // Returns index of fist occurrence of key value in array, or SIZE_MAX if none
 size_t arrayMaxIdx(const Array *array, key_val_func key);
+
+//// Parallel scans (pthreads) ////
+///
+/// Same results as the serial scans above, ties included (always the lowest
+/// index). nthreads == 0 uses every online CPU; arrays too short to split
+/// run on the calling thread. filter() / key() are called from several
+/// threads at once, in no particular order, and arrayParallelIdxOf may skip
+/// elements past the first match.
+
+size_t arrayParallelCount(const Array *array, filter_func key, size_t nthreads);
+size_t arrayParallelIdxOf(const Array *array, filter_func key, size_t nthreads);  // Stops early once a match is known
+size_t arrayParallelMinIdx(const Array *array, key_val_func key, size_t nthreads);
+size_t arrayParallelMaxIdx(const Array *array, key_val_func key, size_t nthreads);
+
+//// Binary search (array must be sorted ascending by `key`) ////
+///
+/// O(log n), branchless. All results are indexes into the array; a result
+/// equal to the length means "past the end".
+
+// Half-open index range [lo, hi)
+typedef struct bds_array_range {
+    size_t lo;
+    size_t hi;
+} ArrayRange;
+
+size_t arrayLowerBound(const Array *array, int target, key_val_func key);  // First idx with key >= target
+size_t arrayUpperBound(const Array *array, int target, key_val_func key);  // First idx with key > target
+ArrayRange arrayEqualRange(const Array *array, int target, key_val_func key);  // Every idx with key == target; empty if none
+
+// Same results; prefetch the next probes. For arrays far larger than the CPU caches.
+size_t arrayLowerBoundPrefetch(const Array *array, int target, key_val_func key);
+size_t arrayUpperBoundPrefetch(const Array *array, int target, key_val_func key);
+
+// Lower bound found by galloping out from `hint`: O(log |result − hint|)
+size_t arrayGallopSearch(const Array *array, size_t hint, int target, key_val_func key);
+
+//// Static search index ////
+///
+/// Immutable copy of the keys of a sorted Array, laid out for lookups
+/// (Eytzinger / BFS order, prefetched four levels ahead). Queries make no
+/// key() calls and touch about one cache line per four tree levels.
+/// Results are indexes into the Array the index was built from. Rebuild
+/// after the Array changes. Safe to query from many threads at once.
+
+typedef struct bds_search_index ArraySearchIndex;
+
+// `array` must be sorted ascending by `key`; calls key() once per element. NULL on OOM.
+ArraySearchIndex *arrayBuildSearchIndex(const Array *array, key_val_func key);
+void searchIndexFree(ArraySearchIndex *index);
+
+size_t searchIndexLength(const ArraySearchIndex *index);
+size_t searchIndexLowerBound(const ArraySearchIndex *index, int target);  // Same result as arrayLowerBound
+size_t searchIndexUpperBound(const ArraySearchIndex *index, int target);  // Same result as arrayUpperBound
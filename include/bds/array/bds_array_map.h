@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include "bds_array_core.h"
+
+//// Memory-mapped records ////
+///
+/// An Array over a mapped region of fixed-size records: data[i] points at
+/// record i inside the mapping. Nothing is read or copied up front; pages
+/// are faulted in on first access. A file's pages live in the page cache,
+/// so every process mapping the same file shares them. Building data[]
+/// is O(n) pointer arithmetic that touches no record.
+///
+/// Everything that takes an Array works on a mapped one; sorts permute
+/// the pointers, never the records. Release with arrayUnmap, not arrayFree.
+
+#define ARRAY_MAP_DEFAULT    0u
+#define ARRAY_MAP_SEQUENTIAL (1u << 0)  // Access hint: read ahead aggressively (scans)
+#define ARRAY_MAP_RANDOM     (1u << 1)  // Access hint: no read-ahead (point lookups); wins over SEQUENTIAL
+#define ARRAY_MAP_POPULATE   (1u << 2)  // Fault every page in now instead of on first access
+#define ARRAY_MAP_WRITABLE   (1u << 3)  // arrayMapFile: stores into records reach the file
+
+// NULL on error, or if the file size is not a multiple of record_size
+Array *arrayMapFile(const char *path, size_t record_size, unsigned int flags);
+
+// `length` zero-filled records, private to this process; NULL on error
+Array *arrayMapAnonymous(size_t length, size_t record_size, unsigned int flags);
+
+void arrayUnmap(Array *array);  // Unmaps the records and frees the Array
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "bds_array_core.h"
+#include "../bds_config.h"
+
+//// Lazy pipelines ////
+///
+/// A chain of filter / map / take stages over an Array that runs only when
+/// a terminal (count, collect, reduce) is called, and then in one fused pass
+/// over array->data: every element goes through all the stages before the
+/// next one is loaded. No intermediate Array is built; only collect
+/// allocates, for its result.
+///
+///   BdsPipe pipe = bdsPipeFrom(orders);
+///   bdsPipeFilter(&pipe, is_paid);
+///   bdsPipeMap(&pipe, order_customer);
+///   Array *customers = bdsPipeCollect(&pipe);
+///
+/// A BdsPipe is a plain value: copy it to branch a pipeline, drop it when
+/// done. It borrows the source Array, which must outlive every terminal call.
+/// Adding more than BDS_PIPE_MAX_STAGES stages marks the pipe broken, and its
+/// terminals then fail (0, NULL, false).
+///
+/// The parallel terminals split the source into contiguous chunks, one per
+/// worker, and join the partial results in source order, so they return the
+/// same as the serial ones. Stages are then called from several threads at
+/// once. A pipe with a take stage always runs on the calling thread.
+
+typedef enum bds_pipe_stage_kind {
+    BDS_PIPE_FILTER,
+    BDS_PIPE_MAP,
+    BDS_PIPE_TAKE,
+} BdsPipeStageKind;
+
+typedef struct bds_pipe_stage {
+    BdsPipeStageKind kind;
+    union {
+        filter_func filter;
+        map_func map;
+        size_t take;
+    };
+} BdsPipeStage;
+
+typedef struct bds_pipe {
+    const Array *source;
+    size_t stage_count;
+    bool broken;  // Too many stages
+    BdsPipeStage stages[BDS_PIPE_MAX_STAGES];
+} BdsPipe;
+
+// Builders: append a stage and return `pipe` (for chaining)
+BdsPipe bdsPipeFrom(const Array *array);
+BdsPipe *bdsPipeFilter(BdsPipe *pipe, filter_func filter);  // Keeps elements where filter() is true
+BdsPipe *bdsPipeMap(BdsPipe *pipe, map_func map);           // Replaces each element by map(element)
+BdsPipe *bdsPipeTake(BdsPipe *pipe, size_t count);          // First `count` elements; the pass stops after them
+
+// Terminals: run the pipeline
+size_t bdsPipeCount(const BdsPipe *pipe);
+Array *bdsPipeCollect(const BdsPipe *pipe);  // New Array of the results; NULL on OOM or a broken pipe
+bool bdsPipeReduce(const BdsPipe *pipe, void *acc, reduce_func reduce);  // false on a broken pipe
+
+// nthreads == 0 uses every online CPU. For ParallelReduce every worker starts
+// from a copy of acc's acc_size bytes, so acc must be combine()'s identity.
+size_t bdsPipeParallelCount(const BdsPipe *pipe, size_t nthreads);
+Array *bdsPipeParallelCollect(const BdsPipe *pipe, size_t nthreads);
+bool bdsPipeParallelReduce(
+    const BdsPipe *pipe,
+    void *acc,
+    size_t acc_size,
+    reduce_func reduce,
+    combine_func combine,
+    size_t nthreads
+);
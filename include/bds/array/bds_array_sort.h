@@ -2,6 +2,9 @@
 
 #include "bds_array_core.h"
 
+// Any in-place Array sort (arrayTimSort, arrayIntroSort, ...)
+typedef void (*array_sort_func)(Array *array, key_val_func key);
+
 /// Sorting (SAME sorted array)
 
 void arrayOddEvenSort(Array *array, key_val_func key);
@@ -16,8 +19,14 @@ void arrayGnomeSort(Array *array, key_val_func key);
 
 //////////////////////////// AVG: O(n log n) ////////////////////////////
 void arrayMergeSort(Array *array, key_val_func key);
+void arrayBottomUpMergeSort(Array *array, key_val_func key);  // Iterative, ping-pong buffers, stable
 void arrayTimSort(Array *array, key_val_func key);
+void arrayBlockMergeSort(Array *array, key_val_func key);  // Stable, no heap memory (fixed 4 KiB stack buffer)
 void arrayIntroSort(Array *array, key_val_func key);
+void arrayPdqSort(Array *array, key_val_func key);  // Pattern-defeating; O(n) on sorted/reverse input
+
+//////////////////////////// AVG: O(n) (non-comparison, int keys) ////////////////////////////
+void arrayRadixSort(Array *array, key_val_func key);
 
 //////////////////////////// AVG: O(n log² n) ///////////////////////////
 void arrayShellSort(Array *array, key_val_func key);
@@ -39,11 +48,87 @@ Array *arrayGnomeSorted(const Array *array, key_val_func key);
 
 // AVG: O(n log n)
 Array *arrayMergeSorted(const Array *array, key_val_func key);
+Array *arrayBottomUpMergeSorted(const Array *array, key_val_func key);
 Array *arrayTimSorted(const Array *array, key_val_func key);
+Array *arrayBlockMergeSorted(const Array *array, key_val_func key);
 Array *arrayIntroSorted(const Array *array, key_val_func key);
+Array *arrayPdqSorted(const Array *array, key_val_func key);
+
+// AVG: O(n) (non-comparison, int keys)
+Array *arrayRadixSorted(const Array *array, key_val_func key);
 
 // AVG: O(n log² n)
 Array *arrayShellSorted(const Array *array, key_val_func key);
 
 // AVG: O(n log n) ; WORST O(n²)
 Array *arrayQuickSorted(const Array *array, key_val_func key);
+
+/// Adaptive sorting. Profiles the input (runs, key range, a sample of the
+/// distinct keys) and dispatches to the sort that fits it best. O(n) on
+/// sorted and reversed input and on keys spanning a range smaller than n;
+/// for n > 256 also on a few distinct keys and (radix, n ≤ 2^17 unless
+/// stable) on dense or random keys; O(n log n) otherwise. Calls key() once per
+/// element unless its buffers cannot be allocated, in which case it falls
+/// back to an Array-level sort that calls key() per comparison. Not stable
+/// unless BDS_SORT_STABLE.
+
+#define BDS_SORT_DEFAULT 0u
+#define BDS_SORT_STABLE  (1u << 0)  // Equal keys keep their relative order
+
+void arraySort(Array *array, key_val_func key, unsigned int flags);
+Array *arraySorted(const Array *array, key_val_func key, unsigned int flags);  // NULL on OOM
+
+/// Selection (k is a 0-based rank in ascending key order). Average O(n):
+/// use these instead of a full sort when only the k smallest matter.
+
+// nth_element: A[k] ends up where a full sort would put it, A[0..k) ≤ A[k] ≤ A(k..n).
+// Returns A[k], or NULL if k ≥ length.
+void *arraySelectKth(Array *array, size_t k, key_val_func key);
+void arrayPartialSort(Array *array, size_t k, key_val_func key);  // A[0..k) = the k smallest, sorted; rest unspecified
+Array *arrayTopK(const Array *array, size_t k, key_val_func key);  // NEW array of the min(k, n) smallest, sorted; NULL on OOM
+
+/// Key-cached sorting: key() is called exactly once per element.
+/// Keys are extracted into a contiguous (key, ptr) buffer, sorted there,
+/// and the pointers are written back. Costs O(n) extra memory.
+
+void arraySortCached(Array *array, key_val_func key, array_sort_func sorter);  // Any sorter, via proxies
+void arrayIntroSortCached(Array *array, key_val_func key);
+void arrayTimSortCached(Array *array, key_val_func key);  // Stable
+
+Array *arraySortedCached(const Array *array, key_val_func key, array_sort_func sorter);
+Array *arrayIntroSortedCached(const Array *array, key_val_func key);
+Array *arrayTimSortedCached(const Array *array, key_val_func key);
+
+/// Parallel sorting (pthreads). nthreads == 0 uses every online CPU.
+/// Small arrays run on fewer threads (see PARALLEL_MIN_CHUNK_LENGTH).
+
+void arrayParallelMergeSort(Array *array, key_val_func key, size_t nthreads);  // Stable
+void arrayParallelIntroSort(Array *array, key_val_func key, size_t nthreads);  // Work-stealing
+void arrayParallelOddEvenSort(Array *array, key_val_func key, size_t nthreads);  // Stable; O(n² / p), a barrier per phase
+void arrayParallelBlockOddEvenSort(Array *array, key_val_func key, size_t nthreads);  // Stable; one block per thread, merge-split
+
+Array *arrayParallelMergeSorted(const Array *array, key_val_func key, size_t nthreads);
+Array *arrayParallelIntroSorted(const Array *array, key_val_func key, size_t nthreads);
+Array *arrayParallelOddEvenSorted(const Array *array, key_val_func key, size_t nthreads);
+Array *arrayParallelBlockOddEvenSorted(const Array *array, key_val_func key, size_t nthreads);
+
+/// Reusable sort workspace. A BdsSortContext owns growable scratch buffers
+/// (merge buffer, key cache, keyed scratch) that the *Ctx sorts borrow
+/// instead of calling malloc. Buffers only grow, so once a context has
+/// seen the largest input, further sorts perform zero heap allocations.
+/// A context must not be shared by concurrent sorts. ctx == NULL behaves
+/// like the plain sort.
+
+typedef struct bds_sort_context BdsSortContext;
+
+BdsSortContext *sortContextNew(void);
+bool sortContextReserve(BdsSortContext *ctx, size_t length);  // Pre-grow for arrays up to length; false on OOM
+void sortContextFree(BdsSortContext *ctx);
+
+void arrayMergeSortCtx(Array *array, key_val_func key, BdsSortContext *ctx);
+void arrayBottomUpMergeSortCtx(Array *array, key_val_func key, BdsSortContext *ctx);
+void arrayTimSortCtx(Array *array, key_val_func key, BdsSortContext *ctx);
+void arrayPdqSortCtx(Array *array, key_val_func key, BdsSortContext *ctx);
+void arrayRadixSortCtx(Array *array, key_val_func key, BdsSortContext *ctx);
+void arrayIntroSortCachedCtx(Array *array, key_val_func key, BdsSortContext *ctx);
+void arrayTimSortCachedCtx(Array *array, key_val_func key, BdsSortContext *ctx);
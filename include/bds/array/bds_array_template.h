@@ -0,0 +1,413 @@
+#pragma once
+
+#include "../bds_config.h"
+#include "../bds_stats.h"
+
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+#include <stdint.h>   // SIZE_MAX
+#include <stdlib.h>   // malloc, calloc, realloc, free
+#include <string.h>   // memcpy
+
+/// ===============================================================
+/// Type-specialized arrays (macro templates)
+/// ===============================================================
+///
+/// Array stores void * and orders through a key_val_func pointer that
+/// the compiler cannot inline across libbds.a. BDS_DEFINE_ARRAY stamps
+/// out a by-value vector of T whose sort / search / heap functions have
+/// the key expression inlined: no per-element allocation, no pointer
+/// chasing, and loops the compiler can unroll and vectorize.
+///
+///   #define POINT_KEY(p) ((p).x)
+///   BDS_DEFINE_ARRAY(PointVec, Point, POINT_KEY)
+///
+///   PointVec *points = PointVecNew(0);
+///   PointVecPush(points, (Point){ 3, 4 });
+///   PointVecSort(points);
+///
+/// KEY is a function-like macro (or static inline function) applied to an
+/// element lvalue of type T; it must yield an integer. Search targets are
+/// passed as long long. Everything generated is static inline, so the
+/// macro may be expanded in a header. BDS_KEY_IDENTITY suits plain
+/// integer element types.
+///
+/// Generated for Name:
+///   Name                        { T *data; size_t length; size_t capacity; }
+///   NameNew(length)             zero-filled; NULL on OOM
+///   NameFree, NameLength, NameAt (pointer or NULL), NamePush, NamePop
+///   NameSort                    IntroSort, not stable, in-place
+///   NameSortStable              merge sort; false on OOM (left untouched)
+///   NameIdxOf, NameMinIdx, NameMaxIdx                 SIZE_MAX if none
+///   NameLowerBound, NameUpperBound                    sorted vectors only
+///   NameHeapify, NameHeapPush, NameHeapPop, NameHeapPeek   min-heap by KEY
+/// ===============================================================
+
+#define BDS_KEY_IDENTITY(elem) (elem)
+
+// Ranges this short are insertion sorted
+#define BDS_TEMPLATE_INSERTION_THRESHOLD 16
+
+#define BDS_DEFINE_ARRAY(Name, T, KEY) \
+    BDS_DEFINE_ARRAY_CORE(Name, T)     \
+    BDS_DEFINE_ARRAY_SORT(Name, T, KEY) \
+    BDS_DEFINE_ARRAY_FIND(Name, T, KEY) \
+    BDS_DEFINE_ARRAY_HEAP(Name, T, KEY)
+
+/// ===============================================================
+/// Lifecycle and access
+/// ===============================================================
+
+#define BDS_DEFINE_ARRAY_CORE(Name, T)                                                        \
+    typedef struct {                                                                          \
+        T *data;                                                                              \
+        size_t length;                                                                        \
+        size_t capacity;                                                                      \
+    } Name;                                                                                   \
+                                                                                              \
+    static inline Name *Name##New(const size_t length) {                                      \
+        Name *vec = (Name *)malloc(sizeof(Name));                                             \
+        if (!vec) return NULL;                                                                \
+                                                                                              \
+        vec->data = NULL;                                                                     \
+        vec->length = length;                                                                 \
+        vec->capacity = length;                                                               \
+                                                                                              \
+        if (length > 0) {                                                                     \
+            BDS_STATS_ADD(allocs, 1);                                                         \
+            vec->data = (T *)calloc(length, sizeof(T));                                       \
+            if (!vec->data) {                                                                 \
+                free(vec);                                                                    \
+                return NULL;                                                                  \
+            }                                                                                 \
+        }                                                                                     \
+                                                                                              \
+        return vec;                                                                           \
+    }                                                                                         \
+                                                                                              \
+    static inline void Name##Free(Name *vec) {                                                \
+        if (!vec) return;                                                                     \
+        free(vec->data);                                                                      \
+        free(vec);                                                                            \
+    }                                                                                         \
+                                                                                              \
+    static inline size_t Name##Length(const Name *vec) {                                      \
+        return vec ? vec->length : 0;                                                         \
+    }                                                                                         \
+                                                                                              \
+    static inline T *Name##At(const Name *vec, const size_t index) {                          \
+        return index < Name##Length(vec) ? &vec->data[index] : NULL;                          \
+    }                                                                                         \
+                                                                                              \
+    static inline bool Name##Push(Name *vec, const T value) {                                 \
+        if (!vec) return false;                                                               \
+                                                                                              \
+        if (vec->length >= vec->capacity) {                                                   \
+            const double grown = (double)vec->capacity * (ARRAY_GEOMETRIC_EXPANSION_RATIO + 1.0); \
+            size_t new_cap = (size_t)grown + 1;                                               \
+            if (new_cap < ARRAY_MINIMUM_CAPACITY) new_cap = ARRAY_MINIMUM_CAPACITY;          \
+                                                                                              \
+            BDS_STATS_ADD(allocs, 1);                                                         \
+            T *new_data = (T *)realloc(vec->data, new_cap * sizeof(T));                       \
+            if (!new_data) return false;                                                      \
+                                                                                              \
+            vec->data = new_data;                                                             \
+            vec->capacity = new_cap;                                                          \
+        }                                                                                     \
+                                                                                              \
+        vec->data[vec->length++] = value;                                                     \
+        return true;                                                                          \
+    }                                                                                         \
+                                                                                              \
+    /* Removes the last element into *out (if out is not NULL); false if empty */             \
+    static inline bool Name##Pop(Name *vec, T *out) {                                         \
+        if (Name##Length(vec) == 0) return false;                                             \
+        vec->length--;                                                                        \
+        if (out) *out = vec->data[vec->length];                                               \
+        return true;                                                                          \
+    }                                                                                         \
+                                                                                              \
+    /* Used by SORT and HEAP alike, so either expands without the other */                    \
+    static inline void bds_##Name##_swap(T *a, T *b) {                                        \
+        const T temp = *a;                                                                    \
+        *a = *b;                                                                              \
+        *b = temp;                                                                            \
+    }
+
+/// ===============================================================
+/// Sorting
+/// ===============================================================
+///
+/// Over T values, comparisons can be branch-free: NameSort is IntroSort
+/// with a branchless Lomuto partition (and pdqsort's skip over keys equal
+/// to the previous pivot), NameSortStable a bottom-up merge sort with a
+/// branchless merge.
+
+#define BDS_DEFINE_ARRAY_SORT(Name, T, KEY)                                                   \
+    /* Stable */                                                                              \
+    static inline void bds_##Name##_insertionRange(T *data, const size_t lo, const size_t hi) { \
+        for (size_t i = lo + 1; i < hi; i++) {                                                \
+            const T item = data[i];                                                           \
+            size_t j = i;                                                                     \
+                                                                                              \
+            while (j > lo && KEY(item) < KEY(data[j - 1])) {                                  \
+                data[j] = data[j - 1];                                                        \
+                j--;                                                                          \
+            }                                                                                 \
+                                                                                              \
+            data[j] = item;                                                                   \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    /* Max-heap over data[0, length), for the IntroSort depth fallback */                     \
+    static inline void bds_##Name##_maxSiftDown(T *data, size_t root, const size_t length) {  \
+        while (2 * root + 1 < length) {                                                       \
+            size_t child = 2 * root + 1;                                                      \
+            if (child + 1 < length && KEY(data[child]) < KEY(data[child + 1])) child++;       \
+            if (!(KEY(data[root]) < KEY(data[child]))) return;                                \
+                                                                                              \
+            bds_##Name##_swap(&data[root], &data[child]);                                     \
+            root = child;                                                                     \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static inline void bds_##Name##_heapSortRange(T *data, const size_t length) {             \
+        for (size_t idx = length / 2; idx > 0; idx--) {                                      \
+            bds_##Name##_maxSiftDown(data, idx - 1, length);                                  \
+        }                                                                                     \
+                                                                                              \
+        for (size_t end = length; end > 1; end--) {                                           \
+            bds_##Name##_swap(&data[0], &data[end - 1]);                                      \
+            bds_##Name##_maxSiftDown(data, 0, end - 1);                                       \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static inline void bds_##Name##_introRange(                                               \
+        T *data, size_t lo, size_t hi, size_t depth_limit, bool leftmost                      \
+    ) {                                                                                       \
+        while (hi - lo > BDS_TEMPLATE_INSERTION_THRESHOLD) {                                  \
+            if (depth_limit-- == 0) {                                                         \
+                bds_##Name##_heapSortRange(data + lo, hi - lo);                               \
+                return;                                                                       \
+            }                                                                                 \
+                                                                                              \
+            /* Median of three, moved to data[lo] */                                          \
+            const size_t mid = lo + (hi - lo) / 2;                                            \
+            if (KEY(data[mid]) < KEY(data[lo])) bds_##Name##_swap(&data[mid], &data[lo]);     \
+            if (KEY(data[hi - 1]) < KEY(data[mid])) {                                         \
+                bds_##Name##_swap(&data[hi - 1], &data[mid]);                                 \
+                if (KEY(data[mid]) < KEY(data[lo])) bds_##Name##_swap(&data[mid], &data[lo]); \
+            }                                                                                 \
+            bds_##Name##_swap(&data[lo], &data[mid]);                                         \
+                                                                                              \
+            const long long pivot = KEY(data[lo]);                                            \
+                                                                                              \
+            /* Equal to the element left of the range, so the smallest key here:              \
+               move every copy of it left and skip them (pdqsort's trick) */                  \
+            const bool skip_equal = !leftmost && !(KEY(data[lo - 1]) < pivot);                \
+                                                                                              \
+            /* Branchless Lomuto: no mispredictions on random keys */                         \
+            size_t first = lo + 1;                                                            \
+            for (size_t i = lo + 1; i < hi; i++) {                                            \
+                const T item = data[i];                                                       \
+                const bool left = skip_equal ? KEY(item) <= pivot : KEY(item) < pivot;        \
+                data[i] = data[first];                                                        \
+                data[first] = item;                                                           \
+                first += left;                                                                \
+            }                                                                                 \
+                                                                                              \
+            if (skip_equal) {                                                                 \
+                lo = first;                                                                   \
+                continue;                                                                     \
+            }                                                                                 \
+                                                                                              \
+            const size_t split = first - 1;                                                   \
+            bds_##Name##_swap(&data[lo], &data[split]);                                       \
+                                                                                              \
+            /* Recurse into the smaller side, loop on the larger: O(log n) stack */           \
+            if (split - lo < hi - split) {                                                    \
+                bds_##Name##_introRange(data, lo, split, depth_limit, leftmost);              \
+                lo = split + 1;                                                               \
+                leftmost = false;                                                             \
+            } else {                                                                          \
+                bds_##Name##_introRange(data, split + 1, hi, depth_limit, false);             \
+                hi = split;                                                                   \
+            }                                                                                 \
+        }                                                                                     \
+                                                                                              \
+        bds_##Name##_insertionRange(data, lo, hi);                                            \
+    }                                                                                         \
+                                                                                              \
+    static inline void Name##Sort(Name *vec) {                                                \
+        const size_t length = Name##Length(vec);                                              \
+        if (length < 2) return;                                                               \
+                                                                                              \
+        size_t depth_limit = 0;                                                               \
+        for (size_t n = length; n > 1; n >>= 1) depth_limit += 2;                             \
+                                                                                              \
+        bds_##Name##_introRange(vec->data, 0, length, depth_limit, true);                     \
+    }                                                                                         \
+                                                                                              \
+    static inline bool Name##SortStable(Name *vec) {                                          \
+        const size_t length = Name##Length(vec);                                              \
+        if (length < 2) return true;                                                          \
+                                                                                              \
+        BDS_STATS_ADD(allocs, 1);                                                             \
+        T *buffer = (T *)malloc(length * sizeof(T));                                          \
+        if (!buffer) return false;                                                            \
+                                                                                              \
+        T *src = vec->data;                                                                   \
+        T *dst = buffer;                                                                      \
+                                                                                              \
+        for (size_t lo = 0; lo < length; lo += BDS_TEMPLATE_INSERTION_THRESHOLD) {           \
+            const size_t hi = lo + BDS_TEMPLATE_INSERTION_THRESHOLD;                          \
+            bds_##Name##_insertionRange(src, lo, hi < length ? hi : length);                  \
+        }                                                                                     \
+                                                                                              \
+        /* Bottom-up passes, ping-ponging between the vector and the buffer */                \
+        for (size_t width = BDS_TEMPLATE_INSERTION_THRESHOLD; width < length; width *= 2) {   \
+            for (size_t lo = 0; lo < length; lo += 2 * width) {                               \
+                const size_t mid = lo + width < length ? lo + width : length;                 \
+                const size_t hi = mid + width < length ? mid + width : length;                \
+                size_t left = lo, right = mid, out = lo;                                      \
+                                                                                              \
+                while (left < mid && right < hi) {                                            \
+                    /* Branchless; ties take the left element: stable */                      \
+                    const bool take_right = KEY(src[right]) < KEY(src[left]);                 \
+                    dst[out++] = take_right ? src[right] : src[left];                         \
+                    right += take_right;                                                      \
+                    left += !take_right;                                                      \
+                }                                                                             \
+                while (left < mid) dst[out++] = src[left++];                                  \
+                while (right < hi) dst[out++] = src[right++];                                 \
+            }                                                                                 \
+                                                                                              \
+            T *temp = src;                                                                    \
+            src = dst;                                                                        \
+            dst = temp;                                                                       \
+        }                                                                                     \
+                                                                                              \
+        if (src != vec->data) memcpy(vec->data, src, length * sizeof(T));                     \
+        free(buffer);                                                                         \
+        return true;                                                                          \
+    }
+
+/// ===============================================================
+/// Search
+/// ===============================================================
+
+#define BDS_DEFINE_ARRAY_FIND(Name, T, KEY)                                                   \
+    /* First index whose key equals target */                                                 \
+    static inline size_t Name##IdxOf(const Name *vec, const long long target) {               \
+        const size_t length = Name##Length(vec);                                              \
+        for (size_t i = 0; i < length; i++) {                                                 \
+            if (KEY(vec->data[i]) == target) return i;                                        \
+        }                                                                                     \
+        return SIZE_MAX;                                                                      \
+    }                                                                                         \
+                                                                                              \
+    /* First index of the smallest key */                                                     \
+    static inline size_t Name##MinIdx(const Name *vec) {                                      \
+        const size_t length = Name##Length(vec);                                              \
+        if (length == 0) return SIZE_MAX;                                                     \
+                                                                                              \
+        size_t best = 0;                                                                      \
+        for (size_t i = 1; i < length; i++) {                                                 \
+            best = KEY(vec->data[i]) < KEY(vec->data[best]) ? i : best;                       \
+        }                                                                                     \
+        return best;                                                                          \
+    }                                                                                         \
+                                                                                              \
+    /* First index of the largest key */                                                      \
+    static inline size_t Name##MaxIdx(const Name *vec) {                                      \
+        const size_t length = Name##Length(vec);                                              \
+        if (length == 0) return SIZE_MAX;                                                     \
+                                                                                              \
+        size_t best = 0;                                                                      \
+        for (size_t i = 1; i < length; i++) {                                                 \
+            best = KEY(vec->data[best]) < KEY(vec->data[i]) ? i : best;                       \
+        }                                                                                     \
+        return best;                                                                          \
+    }                                                                                         \
+                                                                                              \
+    /* First index with key >= target (branchless, like arrayLowerBound) */                   \
+    static inline size_t Name##LowerBound(const Name *vec, const long long target) {          \
+        size_t length = Name##Length(vec);                                                    \
+        if (length == 0) return 0;                                                            \
+                                                                                              \
+        const T *base = vec->data;                                                            \
+        while (length > 1) {                                                                  \
+            const size_t half = length / 2;                                                   \
+            base = KEY(base[half - 1]) < target ? base + half : base;                         \
+            length -= half;                                                                   \
+        }                                                                                     \
+        return (size_t)(base - vec->data) + (KEY(base[0]) < target);                          \
+    }                                                                                         \
+                                                                                              \
+    /* First index with key > target */                                                       \
+    static inline size_t Name##UpperBound(const Name *vec, const long long target) {          \
+        size_t length = Name##Length(vec);                                                    \
+        if (length == 0) return 0;                                                            \
+                                                                                              \
+        const T *base = vec->data;                                                            \
+        while (length > 1) {                                                                  \
+            const size_t half = length / 2;                                                   \
+            base = KEY(base[half - 1]) <= target ? base + half : base;                        \
+            length -= half;                                                                   \
+        }                                                                                     \
+        return (size_t)(base - vec->data) + (KEY(base[0]) <= target);                         \
+    }
+
+/// ===============================================================
+/// Min-heap (smallest key at data[0])
+/// ===============================================================
+
+#define BDS_DEFINE_ARRAY_HEAP(Name, T, KEY)                                                   \
+    static inline void Name##HeapSiftDown(Name *vec, size_t index) {                          \
+        const size_t length = Name##Length(vec);                                              \
+                                                                                              \
+        while (2 * index + 1 < length) {                                                      \
+            size_t child = 2 * index + 1;                                                     \
+            if (child + 1 < length && KEY(vec->data[child + 1]) < KEY(vec->data[child])) child++; \
+            if (!(KEY(vec->data[child]) < KEY(vec->data[index]))) return;                     \
+                                                                                              \
+            bds_##Name##_swap(&vec->data[index], &vec->data[child]);                          \
+            index = child;                                                                    \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static inline void Name##HeapSiftUp(Name *vec, size_t index) {                            \
+        while (index > 0) {                                                                   \
+            const size_t parent = (index - 1) / 2;                                            \
+            if (!(KEY(vec->data[index]) < KEY(vec->data[parent]))) return;                    \
+                                                                                              \
+            bds_##Name##_swap(&vec->data[index], &vec->data[parent]);                         \
+            index = parent;                                                                   \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static inline void Name##Heapify(Name *vec) {                                             \
+        for (size_t idx = Name##Length(vec) / 2; idx > 0; idx--) {                            \
+            Name##HeapSiftDown(vec, idx - 1);                                                 \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static inline bool Name##HeapPush(Name *vec, const T value) {                             \
+        if (!Name##Push(vec, value)) return false;                                            \
+        Name##HeapSiftUp(vec, vec->length - 1);                                               \
+        return true;                                                                          \
+    }                                                                                         \
+                                                                                              \
+    /* Removes the minimum into *out (if out is not NULL); false if empty */                  \
+    static inline bool Name##HeapPop(Name *vec, T *out) {                                     \
+        if (Name##Length(vec) == 0) return false;                                             \
+                                                                                              \
+        if (out) *out = vec->data[0];                                                         \
+        vec->data[0] = vec->data[--vec->length];                                              \
+        Name##HeapSiftDown(vec, 0);                                                           \
+        return true;                                                                          \
+    }                                                                                         \
+                                                                                              \
+    static inline T *Name##HeapPeek(const Name *vec) {                                        \
+        return Name##At(vec, 0);                                                              \
+    }
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "bds_array_core.h"
+#include "../bds_stats.h"
 
 static inline int arrayKeyCompare(
     const void *datapoint_1,
     const void *datapoint_2,
     const key_val_func key
 ) {
+    BDS_STATS_ADD(compares, 1);
+    BDS_STATS_ADD(key_calls, 2);
+
     const int key_1 = key(datapoint_1);
     const int key_2 = key(datapoint_2);
 
@@ -18,6 +22,8 @@ static inline int arrayKeyCompare(
 static inline void arraySwap(Array *array, const size_t idx1, const size_t idx2) {
     if (idx1 == idx2) return;
 
+    BDS_STATS_ADD(swaps, 1);
+
     void *temp = arrayGet(array, idx1);
     arraySet(array, idx1, arrayGet(array, idx2));
     arraySet(array, idx2, temp);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "bds_stats.h"
+
 #include "array/bds_array.h"
 #include "list/bds_list.h"
 
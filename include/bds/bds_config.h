@@ -2,3 +2,16 @@
 
 #define ARRAY_GEOMETRIC_EXPANSION_RATIO 0.25
 #define ARRAY_MINIMUM_CAPACITY 16
+
+// Parallel algorithms never give a worker fewer elements than this
+#define PARALLEL_MIN_CHUNK_LENGTH 4096
+
+// External sort: memory budget when none is given, and the bounds on each
+// run's read buffer (and the output's write buffer) during merges
+#define EXTERNAL_SORT_DEFAULT_BUDGET  ((size_t)256 << 20)
+#define EXTERNAL_SORT_MIN_IO_BUFFER   ((size_t)4 << 10)
+#define EXTERNAL_SORT_MAX_IO_BUFFER   ((size_t)4 << 20)
+#define EXTERNAL_SORT_MAX_FAN_IN      256  // runs per merge; also bounds open files
+
+// Pipelines are values with a fixed stage table, so building one never allocates
+#define BDS_PIPE_MAX_STAGES 16
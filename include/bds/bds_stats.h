@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+
+/// ===============================================================
+/// Operation counters (opt-in: build with -DBDS_STATS, `make STATS=1`)
+/// ===============================================================
+///
+/// Counts what the library's shared helpers and sort kernels do, so a slow sort or
+/// container can be explained: how many keys it compared, how many
+/// elements it moved, how often it went to the allocator.
+///
+/// Counters are thread-local: a snapshot only covers work done on the
+/// calling thread (the worker threads of parallel sorts keep their own).
+/// The counting sites are static inline, so the library and the code
+/// that includes these headers should agree on BDS_STATS.
+///
+/// Without BDS_STATS every counting site expands to ((void)0) and the
+/// instrumented functions compile exactly as before; the API below
+/// still links and reports zeros.
+/// ===============================================================
+
+typedef struct bds_stats {
+    size_t compares;   // arrayKeyCompare, heapKeyCompare, and the key comparisons inside the sort kernels
+    size_t key_calls;  // key() calls from the compares, key caches, sorting-network leaves and partitions
+    size_t swaps;      // arraySwap, heapSwap, and the kernels' own swaps (cached keys included)
+    size_t writes;     // arraySet, and the kernels' element stores: shifts, merges, scatters, key-cache write-back
+    size_t allocs;     // listNodeNew, stack growth, heap add/shrink reallocs
+} BdsStats;
+
+BdsStats bdsStatsSnapshot(void);  // This thread's counters since the last reset
+void bdsStatsReset(void);         // Zeroes this thread's counters
+bool bdsStatsEnabled(void);       // Whether the library was built with BDS_STATS
+
+#ifdef BDS_STATS
+extern _Thread_local BdsStats bds_stats_counters;
+#define BDS_STATS_ADD(field, count) ((void)(bds_stats_counters.field += (size_t)(count)))
+#else
+#define BDS_STATS_ADD(field, count) ((void)0)
+#endif
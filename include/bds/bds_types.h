@@ -59,3 +59,37 @@ typedef void (*deleter_func)(void *elem);
  * @return true if the element satisfies the condition, false otherwise.
  */
 typedef bool (*filter_func)(const void *elem);  // for counters
+
+/**
+ * @brief Transformation applied to each element of a pipeline.
+ *
+ * Used by bdsPipeMap(). The returned pointer replaces the element for every
+ * later stage; it may point into the element (a field), at another object,
+ * or at the element itself. The library never frees or copies it.
+ *
+ * @param elem Pointer to the element to transform.
+ * @return The element's replacement.
+ */
+typedef void *(*map_func)(const void *elem);
+
+/**
+ * @brief Folds one element into an accumulator.
+ *
+ * Used by bdsPipeReduce(). `acc` is user memory (a sum, a struct of
+ * statistics, ...) that the function updates in place.
+ *
+ * @param acc Pointer to the accumulator.
+ * @param elem Pointer to the element to fold in.
+ */
+typedef void (*reduce_func)(void *acc, const void *elem);
+
+/**
+ * @brief Merges a second accumulator into the first.
+ *
+ * Used by bdsPipeParallelReduce() to join the partial results of the
+ * workers, always left to right (`other` covers later elements than `acc`).
+ *
+ * @param acc Pointer to the accumulator that receives the result.
+ * @param other Pointer to the accumulator to merge in.
+ */
+typedef void (*combine_func)(void *acc, const void *other);
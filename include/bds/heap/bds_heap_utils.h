@@ -1,12 +1,16 @@
 #pragma once
 
 #include "bds_heap_core.h"
+#include "../bds_stats.h"
 
 static inline int heapKeyCompare(
     const void *datapoint_1,
     const void *datapoint_2,
     const key_val_func key
 ) {
+    BDS_STATS_ADD(compares, 1);
+    BDS_STATS_ADD(key_calls, 2);
+
     const int key_1 = key(datapoint_1);
     const int key_2 = key(datapoint_2);
 
@@ -30,6 +34,8 @@ static inline size_t heapRightChildIdx(const size_t idx) {
 static inline void heapSwap(Heap *heap, const size_t idx1, const size_t idx2) {
     if (idx1 == idx2) return;
 
+    BDS_STATS_ADD(swaps, 1);
+
     void *temp = heap->data[idx1];
     heap->data[idx1] = heap->data[idx2];
     heap->data[idx2] = temp;
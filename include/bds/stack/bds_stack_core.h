@@ -4,6 +4,7 @@
 #include "../bds_types.h"
 #include "../array/bds_array.h"
 #include "../bds_utils.h"
+#include "../bds_stats.h"
 
 #include <stddef.h>   // size_t
 #include <stdbool.h>  // bool
@@ -61,6 +62,7 @@ static inline void *stackPeek(const Stack *stack) {
 static inline Stack *stackAutoExpand(Stack *stack) {
     if (!stackNeedsExpansion(stack)) return stack;
     const size_t new_cap = (size_t)((double)stack->max_length * (ARRAY_GEOMETRIC_EXPANSION_RATIO + 1.0)) + 1;
+    BDS_STATS_ADD(allocs, 1);
     void **new_data = realloc(stack->data, sizeof(void *) * new_cap);
     return new_data ? (stack->data = new_data, stack->max_length = new_cap, stack) : stack;
 }
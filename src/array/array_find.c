@@ -1,6 +1,9 @@
 /// Find in array
 
 #include "../../include/bds/array/bds_array_find.h"
+#include "../internal/bds_internal.h"
+
+#include <stdbool.h>
 #include <stdint.h>
 
 
@@ -62,3 +65,164 @@ size_t arrayMaxIdx(const Array *array, const key_val_func key) {
     return max_val_idx;
 }
 
+
+/// ===============================================================
+/// Binary search over an Array sorted by key (ascending)
+/// ===============================================================
+///
+/// Branchless: every probe halves the candidate range with a
+/// conditional move instead of a taken/not-taken branch, so a lookup
+/// costs ⌈log2 n⌉ + 1 key() calls and no mispredictions.
+///
+///   [lo, lo + n) holds the answer; probe lo + n/2 − 1 … n ← n − n/2
+/// ===============================================================
+
+/**
+ * First idx in [lo, lo + count) whose key is >= target (upper == false)
+ * or > target (upper == true); lo + count if there is none.
+ */
+static inline size_t findBound(
+    void *const *data,
+    size_t lo,
+    size_t count,
+    const int target,
+    const key_val_func key,
+    const bool upper
+) {
+    if (count == 0) return lo;
+
+    while (count > 1) {
+        const size_t half   = count >> 1;
+        const int probe     = key(data[lo + half - 1]);
+        const bool go_right = upper ? probe <= target : probe < target;
+
+        lo = go_right ? lo + half : lo;  // cmov
+        count -= half;
+    }
+
+    const int last = key(data[lo]);
+    return lo + (upper ? last <= target : last < target);
+}
+
+/**
+ * Same search, with the memory for upcoming probes requested early:
+ * the payloads of both possible next probes, and the pointer slots of
+ * the four probes after that (so those payload addresses are ready in
+ * time). Worth it once the array and its payloads no longer fit in cache.
+ */
+static inline size_t findBoundPrefetch(
+    void *const *data,
+    size_t lo,
+    size_t count,
+    const int target,
+    const key_val_func key,
+    const bool upper
+) {
+    if (count == 0) return lo;
+
+    while (count > 1) {
+        const size_t half  = count >> 1;
+        const size_t half2 = (count - half) >> 1;          // next step
+        const size_t half3 = (count - half - half2) >> 1;  // the one after
+
+        if (half2 > 0) {
+            BDS_PREFETCH(data[lo + half2 - 1]);
+            BDS_PREFETCH(data[lo + half + half2 - 1]);
+        }
+
+        if (half3 > 0) {
+            BDS_PREFETCH(&data[lo + half3 - 1]);
+            BDS_PREFETCH(&data[lo + half2 + half3 - 1]);
+            BDS_PREFETCH(&data[lo + half + half3 - 1]);
+            BDS_PREFETCH(&data[lo + half + half2 + half3 - 1]);
+        }
+
+        const int probe     = key(data[lo + half - 1]);
+        const bool go_right = upper ? probe <= target : probe < target;
+
+        lo = go_right ? lo + half : lo;  // cmov
+        count -= half;
+    }
+
+    const int last = key(data[lo]);
+    return lo + (upper ? last <= target : last < target);
+}
+
+size_t arrayLowerBound(const Array *array, const int target, const key_val_func key) {
+    if (arrayIsEmpty(array)) return 0;
+
+    return findBound(array->data, 0, array->length, target, key, false);
+}
+
+size_t arrayUpperBound(const Array *array, const int target, const key_val_func key) {
+    if (arrayIsEmpty(array)) return 0;
+
+    return findBound(array->data, 0, array->length, target, key, true);
+}
+
+ArrayRange arrayEqualRange(const Array *array, const int target, const key_val_func key) {
+    ArrayRange range = { 0, 0 };
+    if (arrayIsEmpty(array)) return range;
+
+    range.lo = findBound(array->data, 0, array->length, target, key, false);
+    range.hi = findBound(array->data, range.lo, array->length - range.lo, target, key, true);
+
+    return range;
+}
+
+size_t arrayLowerBoundPrefetch(const Array *array, const int target, const key_val_func key) {
+    if (arrayIsEmpty(array)) return 0;
+
+    return findBoundPrefetch(array->data, 0, array->length, target, key, false);
+}
+
+size_t arrayUpperBoundPrefetch(const Array *array, const int target, const key_val_func key) {
+    if (arrayIsEmpty(array)) return 0;
+
+    return findBoundPrefetch(array->data, 0, array->length, target, key, true);
+}
+
+/**
+ * Exponential search from `hint`: O(log d) where d = |answer − hint|.
+ * Steps 1, 2, 4, ... away from the hint until the target is bracketed,
+ * then binary searches inside the bracket. Cheap when consecutive
+ * lookups are close together (e.g. merging sorted streams).
+ */
+size_t arrayGallopSearch(
+    const Array *array,
+    size_t hint,
+    const int target,
+    const key_val_func key
+) {
+    const size_t length = arrayLength(array);
+    if (length == 0) return 0;
+    if (hint >= length) hint = length - 1;
+
+    void *const *data = array->data;
+
+    if (key(data[hint]) < target) {
+        // Answer in (hint, length]: gallop right
+        size_t last_below = hint;  // key < target
+        size_t step = 1;
+
+        while (step < length - hint && key(data[hint + step]) < target) {
+            last_below = hint + step;
+            step <<= 1;
+        }
+
+        const size_t bracket_hi = step < length - hint ? hint + step : length;
+        return findBound(data, last_below + 1, bracket_hi - last_below - 1, target, key, false);
+    }
+
+    // Answer in [0, hint]: gallop left
+    size_t first_at_or_above = hint;  // key >= target
+    size_t step = 1;
+
+    while (step <= hint && key(data[hint - step]) >= target) {
+        first_at_or_above = hint - step;
+        step <<= 1;
+    }
+
+    const size_t bracket_lo = step <= hint ? hint - step + 1 : 0;
+    return findBound(data, bracket_lo, first_at_or_above - bracket_lo, target, key, false);
+}
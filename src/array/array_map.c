@@ -0,0 +1,144 @@
+/// Arrays over memory-mapped records
+
+#define _DEFAULT_SOURCE  // MAP_ANONYMOUS, MAP_POPULATE
+
+#include "../../include/bds/array/bds_array_map.h"
+
+#include <fcntl.h>     // open
+#include <stdint.h>    // SIZE_MAX
+#include <stdlib.h>
+#include <sys/mman.h>  // mmap, munmap, posix_madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/**
+ * The Array handed out is the first member, so arrayUnmap can get back to
+ * the mapping from it:
+ *
+ *   MappedArray { Array { data ──▶ [p0, p1, ...] , length } , base, map_length }
+ *                                    │   │
+ *   base ──▶ [ record 0 | record 1 | ... ]   (file or anonymous mapping)
+ *
+ * data[] is malloc'ed, so an arrayFree by mistake leaks the mapping but
+ * frees nothing it does not own.
+ */
+typedef struct bds_mapped_array {
+    Array array;        // First: a MappedArray * is an Array *
+    void *base;         // NULL when there are no records
+    size_t map_length;  // Bytes mapped at base
+} MappedArray;
+
+static void mappedAdvise(void *base, const size_t map_length, const unsigned int flags) {
+    if (flags & ARRAY_MAP_RANDOM) {
+        (void)posix_madvise(base, map_length, POSIX_MADV_RANDOM);  // A hint: failure is harmless
+    } else if (flags & ARRAY_MAP_SEQUENTIAL) {
+        (void)posix_madvise(base, map_length, POSIX_MADV_SEQUENTIAL);
+    }
+
+#ifndef MAP_POPULATE
+    if (flags & ARRAY_MAP_POPULATE) (void)posix_madvise(base, map_length, POSIX_MADV_WILLNEED);
+#endif
+}
+
+static int mappedPopulateFlag(const unsigned int flags) {
+#ifdef MAP_POPULATE
+    return (flags & ARRAY_MAP_POPULATE) ? MAP_POPULATE : 0;
+#else
+    (void)flags;
+    return 0;
+#endif
+}
+
+/**
+ * Wraps `length` records at base in an Array. Unmaps base on failure.
+ */
+static Array *mappedArrayNew(void *base, const size_t map_length, const size_t length, const size_t record_size) {
+    MappedArray *mapped = (MappedArray *)malloc(sizeof(MappedArray));
+    void **data = length > 0 ? (void **)malloc(length * sizeof(void *)) : NULL;
+
+    if (!mapped || (length > 0 && !data)) {
+        free(mapped);
+        free(data);
+        if (base) munmap(base, map_length);
+        return NULL;
+    }
+
+    char *record = (char *)base;
+    for (size_t idx = 0; idx < length; idx++) {
+        data[idx] = record;
+        record += record_size;
+    }
+
+    mapped->array.data = data;
+    mapped->array.length = length;
+    mapped->base = base;
+    mapped->map_length = map_length;
+
+    return &mapped->array;
+}
+
+Array *arrayMapFile(const char *path, const size_t record_size, const unsigned int flags) {
+    if (!path || record_size == 0) return NULL;
+
+    const bool writable = (flags & ARRAY_MAP_WRITABLE) != 0;
+
+    const int fd = open(path, writable ? O_RDWR : O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || (size_t)info.st_size % record_size != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    const size_t map_length = (size_t)info.st_size;
+    const size_t length = map_length / record_size;
+    void *base = NULL;
+
+    if (map_length > 0) {
+        // MAP_SHARED: the page cache itself, with no private copy even for writes
+        const int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        base = mmap(NULL, map_length, prot, MAP_SHARED | mappedPopulateFlag(flags), fd, 0);
+
+        if (base == MAP_FAILED) {
+            close(fd);
+            return NULL;
+        }
+
+        mappedAdvise(base, map_length, flags);
+    }
+
+    close(fd);  // The mapping keeps the file open
+
+    return mappedArrayNew(base, map_length, length, record_size);
+}
+
+Array *arrayMapAnonymous(const size_t length, const size_t record_size, const unsigned int flags) {
+    if (record_size == 0 || (length > 0 && record_size > SIZE_MAX / length)) return NULL;
+
+    const size_t map_length = length * record_size;
+    void *base = NULL;
+
+    if (map_length > 0) {
+        base = mmap(NULL, map_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | mappedPopulateFlag(flags), -1, 0);
+        if (base == MAP_FAILED) return NULL;
+
+        mappedAdvise(base, map_length, flags);
+    }
+
+    return mappedArrayNew(base, map_length, length, record_size);
+}
+
+void arrayUnmap(Array *array) {
+    if (!arrayExists(array)) return;
+
+    MappedArray *mapped = (MappedArray *)array;
+
+    if (mapped->base) munmap(mapped->base, mapped->map_length);
+    free(mapped->array.data);
+    free(mapped);
+}
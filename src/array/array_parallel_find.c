@@ -0,0 +1,276 @@
+/// Parallel find in array
+
+#include "../../include/bds/array/bds_array_find.h"
+#include "../../include/bds/bds_config.h"
+#include "../internal/bds_parallel.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Every scan splits [0, n) evenly into p contiguous parts, one per worker,
+ * and combines the per-worker results in worker order. Combining in order
+ * is what keeps "first occurrence" exact: on a tie the lower part, which
+ * holds the lower indexes, wins.
+ *
+ *   worker:   0          1          2          3
+ *           [ ...... | .... ✓ . | .. ✓ ... | ....... ]
+ *                          ▲ first match: every worker past it stops
+ */
+
+#define PARALLEL_FIND_STRIDE 256  // elements between two looks at the shared result
+
+typedef struct parallel_find_ctx {
+    const Array *array;
+    filter_func filter;
+    key_val_func key;
+
+    atomic_size_t count;  // arrayParallelCount
+    atomic_size_t found;  // arrayParallelIdxOf: lowest matching idx so far, SIZE_MAX if none
+
+    int *part_keys;       // arrayParallelMinIdx / MaxIdx: best key of each part
+    size_t *part_idxs;    // ... and its idx (SIZE_MAX if the part has none)
+} ParallelFindCtx;
+
+static size_t parallelFindTeamSize(const size_t length, const size_t nthreads) {
+    return parallelTeamSize(length, parallelThreadCount(nthreads), PARALLEL_MIN_CHUNK_LENGTH);
+}
+
+/// ===============================================================
+/// Count
+/// ===============================================================
+
+static void parallelCountWorker(void *arg, const ParallelWorker *worker) {
+    ParallelFindCtx *ctx = (ParallelFindCtx *)arg;
+
+    size_t lo, hi;
+    parallelSplit(arrayLength(ctx->array), worker, &lo, &hi);
+
+    size_t count = 0;
+    for (size_t idx = lo; idx < hi; idx++) {
+        if (ctx->filter(ctx->array->data[idx])) count++;
+    }
+
+    atomic_fetch_add_explicit(&ctx->count, count, memory_order_relaxed);
+}
+
+size_t arrayParallelCount(const Array *array, const filter_func filter, const size_t nthreads) {
+    /*
+    PARALLEL-COUNT(A, filter, p)
+        parallel for each worker w with part [lo, hi) of A do
+            c_w ← |{ i ∈ [lo, hi) : filter(A[i]) }|
+        return Σ c_w
+    */
+
+    /* Time Complexity Analysis:
+       n calls to filter(), n / p per worker, then one atomic add per worker.
+
+       𝒪[T(n)]
+        = 𝒪[n / p + p]
+    */
+
+    /* Additional Memory Analysis:
+       One counter per worker on its own stack, a shared counter in the context.
+
+       𝒪[m(n)]
+        = 𝒪[p]
+    */
+
+    if (!arrayExists(array)) return 0;
+
+    ParallelFindCtx ctx = { .array = array, .filter = filter };
+    atomic_init(&ctx.count, 0);
+
+    parallelRun(parallelFindTeamSize(arrayLength(array), nthreads), parallelCountWorker, &ctx);
+
+    return atomic_load_explicit(&ctx.count, memory_order_relaxed);
+}
+
+/// ===============================================================
+/// First match
+/// ===============================================================
+
+/**
+ * Lowers ctx->found to idx unless another worker already found a lower one.
+ */
+static void parallelFoundAt(ParallelFindCtx *ctx, const size_t idx) {
+    size_t found = atomic_load_explicit(&ctx->found, memory_order_relaxed);
+
+    while (idx < found &&
+           !atomic_compare_exchange_weak_explicit(&ctx->found, &found, idx,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void parallelIdxOfWorker(void *arg, const ParallelWorker *worker) {
+    ParallelFindCtx *ctx = (ParallelFindCtx *)arg;
+
+    size_t lo, hi;
+    parallelSplit(arrayLength(ctx->array), worker, &lo, &hi);
+
+    for (size_t block = lo; block < hi; block += PARALLEL_FIND_STRIDE) {
+        // A match below this block already beats anything this worker can still find
+        if (atomic_load_explicit(&ctx->found, memory_order_relaxed) < block) return;
+
+        const size_t block_end = hi - block > PARALLEL_FIND_STRIDE ? block + PARALLEL_FIND_STRIDE : hi;
+
+        for (size_t idx = block; idx < block_end; idx++) {
+            if (ctx->filter(ctx->array->data[idx])) {
+                parallelFoundAt(ctx, idx);
+                return;  // Scanning upwards: the first match in the part is the part's answer
+            }
+        }
+    }
+}
+
+size_t arrayParallelIdxOf(const Array *array, const filter_func filter, const size_t nthreads) {
+    /*
+    PARALLEL-IDX-OF(A, filter, p)
+        found ← ∞                                     // shared
+        parallel for each worker w with part [lo, hi) of A do
+            for each block [b, b + STRIDE) of [lo, hi) do
+                if found < b then
+                    stop                              // someone matched further left
+                for i ← b to b + STRIDE − 1 do
+                    if filter(A[i]) then
+                        found ← min(found, i)         // CAS loop
+                        stop
+        return found (SIZE_MAX if ∞)
+    */
+
+    /* Time Complexity Analysis:
+       Let f be the first match. Workers whose part starts past f stop within
+       one stride of f being published; the worker holding f scans up to it,
+       and every worker before it must scan its whole part to rule it out.
+
+       𝒪[T(n)]
+        = 𝒪[min(f, n) / p + p · STRIDE]   (no match: 𝒪[n / p])
+    */
+
+    /* Additional Memory Analysis:
+       𝒪[m(n)]
+        = 𝒪[1]
+    */
+
+    if (!arrayExists(array)) return SIZE_MAX;
+
+    ParallelFindCtx ctx = { .array = array, .filter = filter };
+    atomic_init(&ctx.found, SIZE_MAX);
+
+    parallelRun(parallelFindTeamSize(arrayLength(array), nthreads), parallelIdxOfWorker, &ctx);
+
+    return atomic_load_explicit(&ctx.found, memory_order_relaxed);
+}
+
+/// ===============================================================
+/// Min / Max
+/// ===============================================================
+
+/**
+ * Same loop as arrayMinIdx / arrayMaxIdx on the worker's part, so a part
+ * whose keys are all INT32_MAX (min) or INT32_MIN (max) reports SIZE_MAX,
+ * exactly like the serial scan.
+ */
+static void parallelExtremeScan(ParallelFindCtx *ctx, const ParallelWorker *worker, const bool max) {
+    size_t lo, hi;
+    parallelSplit(arrayLength(ctx->array), worker, &lo, &hi);
+
+    int best_key = max ? INT32_MIN : INT32_MAX;
+    size_t best_idx = SIZE_MAX;
+
+    for (size_t idx = lo; idx < hi; idx++) {
+        const int curr_key = ctx->key(ctx->array->data[idx]);
+
+        if (max ? curr_key > best_key : curr_key < best_key) {
+            best_key = curr_key;
+            best_idx = idx;
+        }
+    }
+
+    ctx->part_keys[worker->idx] = best_key;
+    ctx->part_idxs[worker->idx] = best_idx;
+}
+
+static void parallelMinIdxWorker(void *arg, const ParallelWorker *worker) {
+    parallelExtremeScan((ParallelFindCtx *)arg, worker, false);
+}
+
+static void parallelMaxIdxWorker(void *arg, const ParallelWorker *worker) {
+    parallelExtremeScan((ParallelFindCtx *)arg, worker, true);
+}
+
+static size_t parallelExtremeIdx(
+    const Array *array,
+    const key_val_func key,
+    const size_t nthreads,
+    const bool max
+) {
+    if (!arrayExists(array)) return SIZE_MAX;
+
+    const size_t team_size = parallelFindTeamSize(arrayLength(array), nthreads);
+
+    ParallelFindCtx ctx = { .array = array, .key = key };
+    ctx.part_keys = (int *)malloc(team_size * sizeof(int));
+    ctx.part_idxs = (size_t *)malloc(team_size * sizeof(size_t));
+
+    if (!ctx.part_keys || !ctx.part_idxs) {
+        free(ctx.part_keys);
+        free(ctx.part_idxs);
+        return max ? arrayMaxIdx(array, key) : arrayMinIdx(array, key);
+    }
+
+    // A team of one (no threads) fills only part 0; the rest must read "none"
+    for (size_t part = 0; part < team_size; part++) ctx.part_idxs[part] = SIZE_MAX;
+
+    parallelRun(team_size, max ? parallelMaxIdxWorker : parallelMinIdxWorker, &ctx);
+
+    // Strictly better only: on a tie the earlier part (lower idx) is kept
+    int best_key = max ? INT32_MIN : INT32_MAX;
+    size_t best_idx = SIZE_MAX;
+
+    for (size_t part = 0; part < team_size; part++) {
+        if (ctx.part_idxs[part] == SIZE_MAX) continue;
+
+        const int part_key = ctx.part_keys[part];
+        if (max ? part_key > best_key : part_key < best_key) {
+            best_key = part_key;
+            best_idx = ctx.part_idxs[part];
+        }
+    }
+
+    free(ctx.part_keys);
+    free(ctx.part_idxs);
+
+    return best_idx;
+}
+
+size_t arrayParallelMinIdx(const Array *array, const key_val_func key, const size_t nthreads) {
+    /*
+    PARALLEL-MIN-IDX(A, key, p)
+        parallel for each worker w with part [lo, hi) of A do
+            (k_w, i_w) ← (key, idx) of the first minimum in [lo, hi)
+        return i_w of the first w with the smallest k_w
+    */
+
+    /* Time Complexity Analysis:
+       n calls to key(), n / p per worker, then a p-way reduction.
+
+       𝒪[T(n)]
+        = 𝒪[n / p + p]
+    */
+
+    /* Additional Memory Analysis:
+       One (key, idx) slot per worker.
+
+       𝒪[m(n)]
+        = 𝒪[p]
+    */
+
+    return parallelExtremeIdx(array, key, nthreads, false);
+}
+
+size_t arrayParallelMaxIdx(const Array *array, const key_val_func key, const size_t nthreads) {
+    // Mirror of arrayParallelMinIdx: first maximum, SIZE_MAX if every key is INT32_MIN
+    return parallelExtremeIdx(array, key, nthreads, true);
+}
@@ -0,0 +1,509 @@
+/// Lazy pipelines over arrays
+
+#include "../../include/bds/array/bds_array_pipe.h"
+#include "../internal/bds_parallel.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>  // memcpy
+
+/**
+ * The terminals share one kernel, pipeApply(), that walks one element
+ * through the stage table. Each terminal is a single loop over data[] that
+ * calls it and consumes what comes out:
+ *
+ *   data[i] ─▶ filter ─▶ map ─▶ take ─▶ ... ─▶ count / buffer / reduce
+ *                 ✗ drop        ✓ stop after the n-th
+ *
+ * Take stages keep their counters in the caller's `taken` table, so the
+ * pipe itself stays read-only and a terminal can be run again.
+ */
+
+#define PIPE_EMIT 1u  // The element came out of the last stage
+#define PIPE_STOP 2u  // A take stage is exhausted: nothing after this can come out
+
+/// ===============================================================
+/// Builders
+/// ===============================================================
+
+BdsPipe bdsPipeFrom(const Array *array) {
+    BdsPipe pipe;
+    pipe.source = array;
+    pipe.stage_count = 0;
+    pipe.broken = false;
+
+    return pipe;
+}
+
+static BdsPipeStage *pipeAppend(BdsPipe *pipe, const BdsPipeStageKind kind) {
+    if (!pipe) return NULL;
+
+    if (pipe->stage_count == BDS_PIPE_MAX_STAGES) {
+        pipe->broken = true;
+        return NULL;
+    }
+
+    BdsPipeStage *stage = &pipe->stages[pipe->stage_count++];
+    stage->kind = kind;
+
+    return stage;
+}
+
+BdsPipe *bdsPipeFilter(BdsPipe *pipe, const filter_func filter) {
+    BdsPipeStage *stage = pipeAppend(pipe, BDS_PIPE_FILTER);
+    if (stage) stage->filter = filter;
+
+    return pipe;
+}
+
+BdsPipe *bdsPipeMap(BdsPipe *pipe, const map_func map) {
+    BdsPipeStage *stage = pipeAppend(pipe, BDS_PIPE_MAP);
+    if (stage) stage->map = map;
+
+    return pipe;
+}
+
+BdsPipe *bdsPipeTake(BdsPipe *pipe, const size_t count) {
+    BdsPipeStage *stage = pipeAppend(pipe, BDS_PIPE_TAKE);
+    if (stage) stage->take = count;
+
+    return pipe;
+}
+
+/// ===============================================================
+/// Fused kernel
+/// ===============================================================
+
+static bool pipeUsable(const BdsPipe *pipe) {
+    return pipe && !pipe->broken;
+}
+
+static bool pipeHasTake(const BdsPipe *pipe) {
+    for (size_t s = 0; s < pipe->stage_count; s++) {
+        if (pipe->stages[s].kind == BDS_PIPE_TAKE) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Runs *elem through every stage. Returns PIPE_EMIT (with *elem replaced by
+ * the result) if it came out, plus PIPE_STOP if the pass must end after it.
+ */
+static inline unsigned int pipeApply(const BdsPipe *pipe, size_t *taken, void **elem) {
+    unsigned int status = PIPE_EMIT;
+    void *value = *elem;
+
+    for (size_t s = 0; s < pipe->stage_count; s++) {
+        const BdsPipeStage *stage = &pipe->stages[s];
+
+        switch (stage->kind) {
+            case BDS_PIPE_FILTER:
+                if (!stage->filter(value)) return status & PIPE_STOP;
+                break;
+
+            case BDS_PIPE_MAP:
+                value = stage->map(value);
+                break;
+
+            case BDS_PIPE_TAKE:
+                if (taken[s] == stage->take) return PIPE_STOP;  // take(0)
+                if (++taken[s] == stage->take) status |= PIPE_STOP;
+                break;
+        }
+    }
+
+    *elem = value;
+    return status;
+}
+
+/// ===============================================================
+/// Terminal sinks (one chunk [lo, hi) of the source each)
+/// ===============================================================
+
+typedef struct pipe_buffer {
+    void **data;
+    size_t length;
+    size_t capacity;
+} PipeBuffer;
+
+static bool pipeBufferPush(PipeBuffer *buffer, void *elem) {
+    if (buffer->length == buffer->capacity) {
+        size_t grow = (size_t)((double)buffer->capacity * ARRAY_GEOMETRIC_EXPANSION_RATIO);
+        if (grow < ARRAY_MINIMUM_CAPACITY) grow = ARRAY_MINIMUM_CAPACITY;
+
+        void **data = (void **)realloc(buffer->data, (buffer->capacity + grow) * sizeof(void *));
+        if (!data) return false;
+
+        buffer->data = data;
+        buffer->capacity += grow;
+    }
+
+    buffer->data[buffer->length++] = elem;
+    return true;
+}
+
+static size_t pipeCountRange(const BdsPipe *pipe, const size_t lo, const size_t hi) {
+    size_t taken[BDS_PIPE_MAX_STAGES] = { 0 };
+    size_t count = 0;
+
+    for (size_t idx = lo; idx < hi; idx++) {
+        void *elem = pipe->source->data[idx];
+        const unsigned int status = pipeApply(pipe, taken, &elem);
+
+        count += status & PIPE_EMIT;
+        if (status & PIPE_STOP) break;
+    }
+
+    return count;
+}
+
+static bool pipeCollectRange(const BdsPipe *pipe, const size_t lo, const size_t hi, PipeBuffer *out) {
+    size_t taken[BDS_PIPE_MAX_STAGES] = { 0 };
+
+    for (size_t idx = lo; idx < hi; idx++) {
+        void *elem = pipe->source->data[idx];
+        const unsigned int status = pipeApply(pipe, taken, &elem);
+
+        if ((status & PIPE_EMIT) && !pipeBufferPush(out, elem)) return false;
+        if (status & PIPE_STOP) break;
+    }
+
+    return true;
+}
+
+static void pipeReduceRange(
+    const BdsPipe *pipe,
+    const size_t lo,
+    const size_t hi,
+    void *acc,
+    const reduce_func reduce
+) {
+    size_t taken[BDS_PIPE_MAX_STAGES] = { 0 };
+
+    for (size_t idx = lo; idx < hi; idx++) {
+        void *elem = pipe->source->data[idx];
+        const unsigned int status = pipeApply(pipe, taken, &elem);
+
+        if (status & PIPE_EMIT) reduce(acc, elem);
+        if (status & PIPE_STOP) break;
+    }
+}
+
+/**
+ * Hands `buffer` over to a new Array (trimmed to its length).
+ */
+static Array *pipeBufferToArray(PipeBuffer *buffer) {
+    Array *array = (Array *)malloc(sizeof(Array));
+    if (!array) {
+        free(buffer->data);
+        return NULL;
+    }
+
+    array->length = buffer->length;
+    array->data = buffer->data;
+
+    if (buffer->length == 0) {
+        free(buffer->data);
+        array->data = NULL;
+    } else if (buffer->length < buffer->capacity) {
+        void **trimmed = (void **)realloc(buffer->data, buffer->length * sizeof(void *));
+        if (trimmed) array->data = trimmed;
+    }
+
+    return array;
+}
+
+/// ===============================================================
+/// Serial terminals
+/// ===============================================================
+
+size_t bdsPipeCount(const BdsPipe *pipe) {
+    /*
+    PIPE-COUNT(P)
+        c ← 0
+        for each x in source(P) do
+            (y, emitted, stop) ← APPLY(stages(P), x)
+            if emitted then c ← c + 1
+            if stop then break
+        return c
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(source), s = number of stages. One pass; every element
+       goes through at most s stages (fewer once a filter drops it).
+
+       𝒪[T(n)]
+        = 𝒪[n · s]
+    */
+
+    /* Additional Memory Analysis:
+       One take counter per stage, on the stack.
+
+       𝒪[m(n)]
+        = 𝒪[1]
+    */
+
+    if (!pipeUsable(pipe)) return 0;
+
+    return pipeCountRange(pipe, 0, arrayLength(pipe->source));
+}
+
+Array *bdsPipeCollect(const BdsPipe *pipe) {
+    /*
+    PIPE-COLLECT(P)
+        B ← growable buffer
+        for each x in source(P) do
+            (y, emitted, stop) ← APPLY(stages(P), x)
+            if emitted then append y to B
+            if stop then break
+        return B as an Array
+    */
+
+    /* Time Complexity Analysis:
+       One fused pass as in PIPE-COUNT; appends are amortized O(1).
+
+       𝒪[T(n)]
+        = 𝒪[n · s]
+    */
+
+    /* Additional Memory Analysis:
+       Only the result: k pointers for k outputs (plus geometric slack while
+       growing, trimmed at the end).
+
+       𝒪[m(n)]
+        = 𝒪[k]
+    */
+
+    if (!pipeUsable(pipe)) return NULL;
+
+    PipeBuffer buffer = { NULL, 0, 0 };
+
+    if (!pipeCollectRange(pipe, 0, arrayLength(pipe->source), &buffer)) {
+        free(buffer.data);
+        return NULL;
+    }
+
+    return pipeBufferToArray(&buffer);
+}
+
+bool bdsPipeReduce(const BdsPipe *pipe, void *acc, const reduce_func reduce) {
+    /*
+    PIPE-REDUCE(P, acc, reduce)
+        for each x in source(P) do
+            (y, emitted, stop) ← APPLY(stages(P), x)
+            if emitted then reduce(acc, y)
+            if stop then break
+    */
+
+    /* Time Complexity Analysis:
+       𝒪[T(n)]
+        = 𝒪[n · s]
+    */
+
+    /* Additional Memory Analysis:
+       𝒪[m(n)]
+        = 𝒪[1]
+    */
+
+    if (!pipeUsable(pipe) || !acc || !reduce) return false;
+
+    pipeReduceRange(pipe, 0, arrayLength(pipe->source), acc, reduce);
+    return true;
+}
+
+/// ===============================================================
+/// Parallel terminals
+/// ===============================================================
+
+typedef struct pipe_parallel_ctx {
+    const BdsPipe *pipe;
+
+    atomic_size_t count;   // Count
+    PipeBuffer *buffers;   // Collect: one per worker
+    atomic_bool failed;    // Collect: a worker ran out of memory
+    unsigned char *accs;   // Reduce: acc_size bytes per worker
+    size_t acc_size;
+    reduce_func reduce;
+} PipeParallelCtx;
+
+static size_t pipeTeamSize(const BdsPipe *pipe, const size_t nthreads) {
+    // A take stage counts elements in source order, which chunks cannot share
+    if (pipeHasTake(pipe)) return 1;
+
+    return parallelTeamSize(
+        arrayLength(pipe->source),
+        parallelThreadCount(nthreads),
+        PARALLEL_MIN_CHUNK_LENGTH
+    );
+}
+
+static void pipeCountWorker(void *arg, const ParallelWorker *worker) {
+    PipeParallelCtx *ctx = (PipeParallelCtx *)arg;
+
+    size_t lo, hi;
+    parallelSplit(arrayLength(ctx->pipe->source), worker, &lo, &hi);
+
+    atomic_fetch_add_explicit(&ctx->count, pipeCountRange(ctx->pipe, lo, hi), memory_order_relaxed);
+}
+
+static void pipeCollectWorker(void *arg, const ParallelWorker *worker) {
+    PipeParallelCtx *ctx = (PipeParallelCtx *)arg;
+
+    size_t lo, hi;
+    parallelSplit(arrayLength(ctx->pipe->source), worker, &lo, &hi);
+
+    if (!pipeCollectRange(ctx->pipe, lo, hi, &ctx->buffers[worker->idx])) {
+        atomic_store_explicit(&ctx->failed, true, memory_order_relaxed);
+    }
+}
+
+static void pipeReduceWorker(void *arg, const ParallelWorker *worker) {
+    PipeParallelCtx *ctx = (PipeParallelCtx *)arg;
+
+    size_t lo, hi;
+    parallelSplit(arrayLength(ctx->pipe->source), worker, &lo, &hi);
+
+    pipeReduceRange(ctx->pipe, lo, hi, ctx->accs + worker->idx * ctx->acc_size, ctx->reduce);
+}
+
+size_t bdsPipeParallelCount(const BdsPipe *pipe, const size_t nthreads) {
+    /*
+    PIPE-PARALLEL-COUNT(P, p)
+        parallel for each worker w with chunk [lo, hi) of source(P) do
+            c_w ← PIPE-COUNT over [lo, hi)
+        return Σ c_w
+    */
+
+    /* Time Complexity Analysis:
+       𝒪[T(n)]
+        = 𝒪[n · s / p + p]
+    */
+
+    /* Additional Memory Analysis:
+       𝒪[m(n)]
+        = 𝒪[p]   (worker stacks)
+    */
+
+    if (!pipeUsable(pipe)) return 0;
+
+    PipeParallelCtx ctx = { .pipe = pipe };
+    atomic_init(&ctx.count, 0);
+
+    parallelRun(pipeTeamSize(pipe, nthreads), pipeCountWorker, &ctx);
+
+    return atomic_load_explicit(&ctx.count, memory_order_relaxed);
+}
+
+Array *bdsPipeParallelCollect(const BdsPipe *pipe, const size_t nthreads) {
+    /*
+    PIPE-PARALLEL-COLLECT(P, p)
+        parallel for each worker w with chunk [lo, hi) of source(P) do
+            B_w ← PIPE-COLLECT over [lo, hi)
+        return B_0 ++ B_1 ++ ... ++ B_{p−1}     // source order
+    */
+
+    /* Time Complexity Analysis:
+       The fused pass in parallel, then one serial copy of the k outputs.
+
+       𝒪[T(n)]
+        = 𝒪[n · s / p + k]
+    */
+
+    /* Additional Memory Analysis:
+       The per-worker buffers and the result both hold every output once.
+
+       𝒪[m(n)]
+        = 𝒪[k + p]
+    */
+
+    if (!pipeUsable(pipe)) return NULL;
+
+    const size_t team_size = pipeTeamSize(pipe, nthreads);
+    if (team_size == 1) return bdsPipeCollect(pipe);
+
+    PipeParallelCtx ctx = { .pipe = pipe };
+    atomic_init(&ctx.failed, false);
+
+    ctx.buffers = (PipeBuffer *)calloc(team_size, sizeof(PipeBuffer));
+    if (!ctx.buffers) return bdsPipeCollect(pipe);
+
+    parallelRun(team_size, pipeCollectWorker, &ctx);
+
+    Array *result = NULL;
+
+    if (!atomic_load_explicit(&ctx.failed, memory_order_relaxed)) {
+        size_t total = 0;
+        for (size_t w = 0; w < team_size; w++) total += ctx.buffers[w].length;
+
+        result = arrayNew(total);
+
+        if (result) {
+            size_t offset = 0;
+
+            for (size_t w = 0; w < team_size; w++) {
+                if (ctx.buffers[w].length == 0) continue;
+
+                memcpy(result->data + offset, ctx.buffers[w].data, ctx.buffers[w].length * sizeof(void *));
+                offset += ctx.buffers[w].length;
+            }
+        }
+    }
+
+    for (size_t w = 0; w < team_size; w++) free(ctx.buffers[w].data);
+    free(ctx.buffers);
+
+    return result;
+}
+
+bool bdsPipeParallelReduce(
+    const BdsPipe *pipe,
+    void *acc,
+    const size_t acc_size,
+    const reduce_func reduce,
+    const combine_func combine,
+    const size_t nthreads
+) {
+    /*
+    PIPE-PARALLEL-REDUCE(P, acc, reduce, combine, p)
+        parallel for each worker w with chunk [lo, hi) of source(P) do
+            a_w ← copy of acc
+            PIPE-REDUCE over [lo, hi) into a_w
+        acc ← a_0
+        for w ← 1 to p − 1 do
+            combine(acc, a_w)                   // left to right: source order
+    */
+
+    /* Time Complexity Analysis:
+       𝒪[T(n)]
+        = 𝒪[n · s / p + p]
+    */
+
+    /* Additional Memory Analysis:
+       One accumulator copy per worker.
+
+       𝒪[m(n)]
+        = 𝒪[p · acc_size]
+    */
+
+    if (!pipeUsable(pipe) || !acc || acc_size == 0 || !reduce || !combine) return false;
+
+    const size_t team_size = pipeTeamSize(pipe, nthreads);
+    if (team_size == 1) return bdsPipeReduce(pipe, acc, reduce);
+
+    PipeParallelCtx ctx = { .pipe = pipe, .acc_size = acc_size, .reduce = reduce };
+
+    ctx.accs = (unsigned char *)malloc(team_size * acc_size);
+    if (!ctx.accs) return bdsPipeReduce(pipe, acc, reduce);
+
+    for (size_t w = 0; w < team_size; w++) memcpy(ctx.accs + w * acc_size, acc, acc_size);
+
+    parallelRun(team_size, pipeReduceWorker, &ctx);
+
+    // A team of one (no threads) reduced everything into accs[0]; the rest still hold acc
+    memcpy(acc, ctx.accs, acc_size);
+    for (size_t w = 1; w < team_size; w++) combine(acc, ctx.accs + w * acc_size);
+
+    free(ctx.accs);
+    return true;
+}
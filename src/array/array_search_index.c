@@ -0,0 +1,181 @@
+/// Static search index (Eytzinger layout) over a sorted Array
+
+#include "../../include/bds/array/bds_array_find.h"
+#include "../internal/bds_internal.h"
+
+#include <stdlib.h>
+
+/**
+ * The keys of a sorted Array are copied once, in BFS order of the
+ * implicit binary search tree ("Eytzinger" layout, as in a binary heap):
+ *
+ *   sorted:  10 20 30 40 50 60 70          keys[1..n]:  40 20 60 10 30 50 70
+ *                                          root = 1, children of k = 2k, 2k+1
+ *
+ * A lookup walks k ← 2k + (keys[k] < target). Compared with binary search
+ * over Array->data:
+ *   - probes read plain ints, never a payload pointer (no key() calls);
+ *   - the first levels of every query share the same few cache lines;
+ *   - the 16 descendants four levels down, keys[16k .. 16k + 15], are one
+ *     64-byte line, so it is prefetched four iterations before it is read.
+ *
+ * The answer is turned back into an Array index arithmetically (in-order
+ * rank of the node), so a query reads nothing but keys[].
+ *
+ * Stays immutable after the build; any number of threads may query it.
+ */
+
+#define SEARCH_INDEX_LINE_BYTES   64
+#define SEARCH_INDEX_PREFETCH_MUL 16  // keys per line: descendants 4 levels down
+
+struct bds_search_index {
+    int *keys;          // keys[1..length] in Eytzinger order; keys[0] unused
+    size_t length;
+    size_t height;      // ⌊log2 length⌋: depth of the (possibly partial) last level
+    size_t last_level;  // nodes present on the last level
+};
+
+static inline size_t searchIndexLog2(const size_t n) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(63 - __builtin_clzll((unsigned long long)n));
+#else
+    size_t result = 0;
+    for (size_t k = n; k > 1; k >>= 1) result++;
+    return result;
+#endif
+}
+
+/// ===============================================================
+/// Build
+/// ===============================================================
+
+/**
+ * In-order walk of the implicit tree: node k receives the next sorted
+ * element. Returns the next unused sorted index. Recursion depth is log2 n.
+ */
+static size_t searchIndexFill(
+    ArraySearchIndex *index,
+    const Array *array,
+    const key_val_func key,
+    size_t sorted_idx,
+    const size_t node
+) {
+    if (node > index->length) return sorted_idx;
+
+    sorted_idx = searchIndexFill(index, array, key, sorted_idx, node << 1);
+
+    index->keys[node] = key(arrayGet(array, sorted_idx));
+    sorted_idx++;
+
+    return searchIndexFill(index, array, key, sorted_idx, (node << 1) | 1u);
+}
+
+ArraySearchIndex *arrayBuildSearchIndex(const Array *array, const key_val_func key) {
+    ArraySearchIndex *index = (ArraySearchIndex *)malloc(sizeof(ArraySearchIndex));
+    if (!index) return NULL;
+
+    const size_t length = arrayLength(array);
+
+    // Line-aligned, so keys[16k..16k+15] never straddle two cache lines
+    size_t key_bytes = (length + 1) * sizeof(int);
+    key_bytes = (key_bytes + SEARCH_INDEX_LINE_BYTES - 1) / SEARCH_INDEX_LINE_BYTES * SEARCH_INDEX_LINE_BYTES;
+
+    index->length     = length;
+    index->height     = length > 0 ? searchIndexLog2(length) : 0;
+    index->last_level = length - (((size_t)1 << index->height) - 1);
+    index->keys       = (int *)aligned_alloc(SEARCH_INDEX_LINE_BYTES, key_bytes);
+
+    if (!index->keys) {
+        free(index);
+        return NULL;
+    }
+
+    index->keys[0] = 0;
+
+    searchIndexFill(index, array, key, 0, 1);
+
+    return index;
+}
+
+void searchIndexFree(ArraySearchIndex *index) {
+    if (!index) return;
+
+    free(index->keys);
+    free(index);
+}
+
+size_t searchIndexLength(const ArraySearchIndex *index) {
+    return index ? index->length : 0;
+}
+
+/// ===============================================================
+/// Query
+/// ===============================================================
+
+/**
+ * Strips the trailing 1-bits (the right turns taken after the last left
+ * turn) plus the 0-bit above them: what is left is the node where the
+ * search last went left, i.e. the first key that compared >= (or >).
+ * 0 means the search never went left: the answer is past the end.
+ */
+static inline size_t searchIndexLastLeftTurn(const size_t node) {
+#if defined(__GNUC__) || defined(__clang__)
+    return node >> (__builtin_ctzll(~(unsigned long long)node) + 1);
+#else
+    size_t k = node;
+    while (k & 1u) k >>= 1;
+    return k >> 1;
+#endif
+}
+
+/**
+ * In-order rank (= index in the source Array) of node k ≥ 1.
+ * In a perfect tree of this height, node k at depth d has rank
+ *     r = ((2·(k − 2^d) + 1) · 2^(height − d)) − 1
+ * and the last level holds exactly the even ranks; subtract the
+ * last-level slots left of r that are not actually present.
+ */
+static inline size_t searchIndexRank(const ArraySearchIndex *index, const size_t node) {
+    const size_t depth   = searchIndexLog2(node);
+    const size_t perfect = ((((node - ((size_t)1 << depth)) << 1) | 1u) << (index->height - depth)) - 1;
+    const size_t before  = (perfect + 1) >> 1;  // last-level slots left of `perfect`
+
+    return perfect - (before > index->last_level ? before - index->last_level : 0);
+}
+
+static inline size_t searchIndexDescend(
+    const ArraySearchIndex *index,
+    const int target,
+    const bool upper
+) {
+    const int *keys = index->keys;
+    const size_t length = index->length;
+
+    size_t node = 1;
+
+    while (node <= length) {
+        // Only prefetch lines that exist (the branch flips once per query)
+        if (node * SEARCH_INDEX_PREFETCH_MUL <= length) {
+            BDS_PREFETCH(keys + node * SEARCH_INDEX_PREFETCH_MUL);
+        }
+
+        const int probe = keys[node];
+        node = (node << 1) | (size_t)(upper ? probe <= target : probe < target);  // no branch
+    }
+
+    node = searchIndexLastLeftTurn(node);
+
+    return node == 0 ? length : searchIndexRank(index, node);
+}
+
+size_t searchIndexLowerBound(const ArraySearchIndex *index, const int target) {
+    if (!index || index->length == 0) return 0;
+
+    return searchIndexDescend(index, target, false);
+}
+
+size_t searchIndexUpperBound(const ArraySearchIndex *index, const int target) {
+    if (!index || index->length == 0) return 0;
+
+    return searchIndexDescend(index, target, true);
+}
@@ -0,0 +1,337 @@
+/// Block Merge Sort O(n log n) | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_sort_network.h"
+
+#include <string.h>  // memcpy, memmove
+
+
+// Stable merge sort for arrays too large to double: the scratch space is a
+// fixed buffer on the stack, whatever the length of the array.
+
+/**
+ * 1. **Blocks**: sort blocks of BLOCK_MERGE_BLOCK elements with the sorting network.
+ * 2. **Levels**: merge neighbouring runs of width w = 32, 64, ... in place.
+ * 3. **Buffered merge**: if the shorter run fits in the buffer, move it there
+ *    and merge straight back into the array (forward if it was the left run,
+ *    backward if it was the right one).
+ * 4. **Rotation merge**: otherwise split the longer run in the middle, binary
+ *    search that key in the other run, and rotate the two inner pieces past
+ *    each other (SymMerge). That leaves two independent, smaller merges:
+ *
+ *      [ A1 | A2 ][ B1 | B2 ]   A2 > x ≥ B1   ──rotate──▶   [ A1 | B1 ][ A2 | B2 ]
+ *                                                            merge ^    merge ^
+ *
+ *    Recurse into the smaller one, loop on the larger: O(log n) stack.
+ * 5. **Ordered pairs**: if the last key of the left run <= the first key of
+ *    the right run, the merge is skipped.
+ */
+
+#define BLOCK_MERGE_BLOCK         32   // ≤ SORT_NETWORK_MAX_LENGTH
+#define BLOCK_MERGE_BUFFER_LENGTH 512  // 4 KiB of pointers on the stack
+
+/// ===============================================================
+/// Helpers
+/// ===============================================================
+
+/**
+ * First index in data[lo, hi) whose key is >= target_key (or > with `upper`).
+ */
+static size_t blockMergeSearch(
+    void *const *data,
+    size_t lo,
+    size_t hi,
+    const int target_key,
+    const bool upper,
+    const key_val_func key
+) {
+    while (lo < hi) {
+        const size_t mid = lo + ((hi - lo) >> 1);
+        const int mid_key = key(data[mid]);
+
+        BDS_STATS_ADD(key_calls, 1);
+        BDS_STATS_ADD(compares, 1);
+
+        if (mid_key < target_key || (upper && mid_key == target_key)) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+static void blockMergeReverse(void **data, size_t lo, size_t hi) {
+    while (lo + 1 < hi) {
+        void *swap_tmp = data[lo];
+        data[lo++] = data[--hi];
+        data[hi] = swap_tmp;
+    }
+}
+
+/**
+ * Swaps data[lo, mid) with data[mid, hi). Three memcpy/memmoves when either
+ * side fits in the buffer, three reversals otherwise.
+ */
+static void blockMergeRotate(void **data, const size_t lo, const size_t mid, const size_t hi, void **buffer) {
+    const size_t left_len  = mid - lo;
+    const size_t right_len = hi - mid;
+
+    if (left_len == 0 || right_len == 0) return;
+
+    BDS_STATS_ADD(writes, hi - lo);  // Counted once, though the reversals store each element twice
+
+    if (left_len <= right_len && left_len <= BLOCK_MERGE_BUFFER_LENGTH) {
+        memcpy(buffer, &data[lo], left_len * sizeof(void *));
+        memmove(&data[lo], &data[mid], right_len * sizeof(void *));
+        memcpy(&data[lo + right_len], buffer, left_len * sizeof(void *));
+    } else if (right_len <= BLOCK_MERGE_BUFFER_LENGTH) {
+        memcpy(buffer, &data[mid], right_len * sizeof(void *));
+        memmove(&data[lo + right_len], &data[lo], left_len * sizeof(void *));
+        memcpy(&data[lo], buffer, right_len * sizeof(void *));
+    } else {
+        blockMergeReverse(data, lo, mid);
+        blockMergeReverse(data, mid, hi);
+        blockMergeReverse(data, lo, hi);
+    }
+}
+
+/**
+ * Stable merge of data[lo, mid) and data[mid, hi), both non-empty, where the
+ * shorter one fits in the buffer. Each element's key is computed once.
+ */
+static void blockMergeBuffered(
+    void **data,
+    const size_t lo,
+    const size_t mid,
+    const size_t hi,
+    void **buffer,
+    const key_val_func key
+) {
+    const size_t left_len  = mid - lo;
+    const size_t right_len = hi - mid;
+
+    BDS_STATS_ADD(writes, hi - lo);  // At most; the early returns leave a tail in place
+    BDS_STATS_ADD(key_calls, 2);
+
+    if (left_len <= right_len) {
+        // Left run to the buffer, merge forward into data[lo, ...)
+        memcpy(buffer, &data[lo], left_len * sizeof(void *));
+
+        size_t buffer_idx = 0;
+        size_t right_idx  = mid;
+        size_t write_idx  = lo;
+
+        int left_key  = key(buffer[0]);
+        int right_key = key(data[mid]);
+
+        while (1) {
+            BDS_STATS_ADD(key_calls, 1);
+            BDS_STATS_ADD(compares, 1);
+
+            if (left_key <= right_key) {
+                data[write_idx++] = buffer[buffer_idx++];  // Stable: left wins ties
+                if (buffer_idx == left_len) return;        // The rest of the right run is in place
+                left_key = key(buffer[buffer_idx]);
+            } else {
+                data[write_idx++] = data[right_idx++];
+                if (right_idx == hi) break;
+                right_key = key(data[right_idx]);
+            }
+        }
+
+        memcpy(&data[write_idx], &buffer[buffer_idx], (left_len - buffer_idx) * sizeof(void *));
+    } else {
+        // Right run to the buffer, merge backward into data[..., hi)
+        memcpy(buffer, &data[mid], right_len * sizeof(void *));
+
+        size_t buffer_idx = right_len;  // one past the next right element
+        size_t left_idx   = mid;        // one past the next left element
+        size_t write_idx  = hi;
+
+        int left_key  = key(data[mid - 1]);
+        int right_key = key(buffer[right_len - 1]);
+
+        while (1) {
+            BDS_STATS_ADD(key_calls, 1);
+            BDS_STATS_ADD(compares, 1);
+
+            if (left_key > right_key) {
+                data[--write_idx] = data[--left_idx];      // Stable: right wins ties from the back
+                if (left_idx == lo) break;
+                left_key = key(data[left_idx - 1]);
+            } else {
+                data[--write_idx] = buffer[--buffer_idx];
+                if (buffer_idx == 0) return;               // The rest of the left run is in place
+                right_key = key(buffer[buffer_idx - 1]);
+            }
+        }
+
+        memcpy(&data[lo], buffer, buffer_idx * sizeof(void *));
+    }
+}
+
+/**
+ * Stable in-place merge of data[lo, mid) and data[mid, hi).
+ */
+static void blockMergeRuns(
+    void **data,
+    size_t lo,
+    size_t mid,
+    size_t hi,
+    void **buffer,
+    const key_val_func key
+) {
+    while (lo < mid && mid < hi) {
+        const int first_right_key = key(data[mid]);
+        const int last_left_key   = key(data[mid - 1]);
+
+        BDS_STATS_ADD(key_calls, 2);
+        BDS_STATS_ADD(compares, 1);
+
+        if (last_left_key <= first_right_key) return;  // Already in order
+
+        // Trim what is already in its final place at both ends
+        lo = blockMergeSearch(data, lo, mid, first_right_key, true, key);
+        hi = blockMergeSearch(data, mid, hi, last_left_key, false, key);
+
+        const size_t left_len  = mid - lo;
+        const size_t right_len = hi - mid;
+
+        if (left_len <= BLOCK_MERGE_BUFFER_LENGTH || right_len <= BLOCK_MERGE_BUFFER_LENGTH) {
+            blockMergeBuffered(data, lo, mid, hi, buffer, key);
+            return;
+        }
+
+        // SymMerge split: cut the longer run in half, find the matching cut in the other
+        size_t left_cut, right_cut;
+
+        BDS_STATS_ADD(key_calls, 1);  // The cut's key
+
+        if (left_len >= right_len) {
+            left_cut  = lo + (left_len >> 1);
+            right_cut = blockMergeSearch(data, mid, hi, key(data[left_cut]), false, key);
+        } else {
+            right_cut = mid + (right_len >> 1);
+            left_cut  = blockMergeSearch(data, lo, mid, key(data[right_cut]), true, key);
+        }
+
+        blockMergeRotate(data, left_cut, mid, right_cut, buffer);
+        const size_t new_mid = left_cut + (right_cut - mid);
+
+        // Recurse into the smaller merge, loop on the larger one
+        if (new_mid - lo < hi - new_mid) {
+            blockMergeRuns(data, lo, left_cut, new_mid, buffer, key);
+            lo  = new_mid;
+            mid = right_cut;
+        } else {
+            blockMergeRuns(data, new_mid, right_cut, hi, buffer, key);
+            hi  = new_mid;
+            mid = left_cut;
+        }
+    }
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+void arrayBlockMergeSort(Array *array, const key_val_func key) {
+    /*
+    BLOCK-MERGE-SORT(A, key)
+        n ← length(A)
+        B ← buffer of 512 pointers            // fixed, on the stack
+
+        for lo ← 0 to n − 1 step 32 do
+            NETWORK-SORT(A, lo, min(lo + 32, n), key)
+
+        for width ← 32, 64, 128, ... while width < n do
+            for lo ← 0 to n − 1 step 2·width do
+                MERGE(A, lo, min(lo + width, n), min(lo + 2·width, n), B, key)
+
+    MERGE(A, lo, mid, hi, B, key)
+        while lo < mid < hi do
+            if key(A[mid − 1]) ≤ key(A[mid]) then
+                return                          // already ordered
+
+            lo ← UPPER-BOUND(A[lo..mid), key(A[mid]))
+            hi ← LOWER-BOUND(A[mid..hi), key(A[mid − 1]))
+
+            if min(mid − lo, hi − mid) ≤ |B| then
+                move the shorter run to B, merge it back into A
+                return
+
+            if mid − lo ≥ hi − mid then
+                l ← lo + ⌊(mid − lo)/2⌋
+                r ← LOWER-BOUND(A[mid..hi), key(A[l]))
+            else
+                r ← mid + ⌊(hi − mid)/2⌋
+                l ← UPPER-BOUND(A[lo..mid), key(A[r]))
+
+            ROTATE(A[l..mid), A[mid..r))
+            m ← l + (r − mid)
+
+            MERGE the smaller of (lo, l, m) and (m, r, hi) recursively,
+            continue with the larger
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), B = 512 (buffer), b = 32 (block).
+
+       Blocks:  n/b network sorts of b elements ⇒ Θ(n).
+       Levels:  ⌈log2(n/b)⌉ levels.
+
+       A merge of m elements whose runs are both longer than B splits until the
+       shorter side fits in B: O(log(m/B)) rounds of rotations, O(m) moves each,
+       and O(m) key comparisons in total (binary searches + buffered merges).
+
+       Levels with width ≤ B:   Θ(n) per level, like arrayBottomUpMergeSort.
+       Levels with width > B:   O(n log(width/B)) moves per level.
+
+       T(n) = Θ(n log n)                      comparisons
+       T(n) = O(n log n + n log²(n/B))        moves (pointer copies)
+       T(n) = Θ(n)                            already sorted
+
+       𝒪[T(n)]
+        = 𝒪[n log² n]   worst case; Θ(n log n) while n/B is small
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = B + log n
+
+       - buffer: B pointers on the stack, independent of n.
+       - recursion stack: Θ(log n) depth (smaller merge first).
+       - no heap allocation: cannot fail.
+
+       𝒪[m(n)]
+        = 𝒪[log n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    for (size_t lo = 0; lo < length; lo += BLOCK_MERGE_BLOCK) {
+        const size_t hi = length - lo < BLOCK_MERGE_BLOCK ? length : lo + BLOCK_MERGE_BLOCK;
+        sortNetworkSortRange(array, lo, hi, key);
+    }
+
+    if (length <= BLOCK_MERGE_BLOCK) return;
+
+    void *buffer[BLOCK_MERGE_BUFFER_LENGTH];
+
+    for (size_t width = BLOCK_MERGE_BLOCK; width < length; width <<= 1) {
+        for (size_t lo = 0; lo + width < length; lo += width << 1) {
+            const size_t mid = lo + width;
+            const size_t hi  = length - mid < width ? length : mid + width;
+
+            blockMergeRuns(array->data, lo, mid, hi, buffer, key);
+        }
+    }
+}
+
+Array *arrayBlockMergeSorted(const Array *array, const key_val_func key) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayBlockMergeSort(sorted_array, key);
+
+    return sorted_array;
+}
@@ -202,6 +202,9 @@ void arrayCombSort(Array *array, const key_val_func key) {
             const int this_val = key(arrayGet(array, this_idx));
             const int gap_val = key(arrayGet(array, gap_idx));
 
+            BDS_STATS_ADD(key_calls, 2);
+            BDS_STATS_ADD(compares, 1);
+
             if (this_val > gap_val) {
                 arraySwap(array, this_idx, gap_idx);
                 swapped = true;
@@ -0,0 +1,741 @@
+/// External Merge Sort O(n log n) | FILE
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../../include/bds/array/bds_array_external.h"
+#include "../../../include/bds/bds_config.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_parallel.h"
+
+#include <errno.h>
+#include <fcntl.h>   // posix_fadvise
+#include <stdint.h>  // uint32_t
+#include <stdio.h>   // snprintf
+#include <stdlib.h>
+#include <string.h>  // memcpy, memmove
+#include <unistd.h>  // read, write, close, unlink
+
+
+// Sorting for data that does not fit in memory: sort what fits, spill it, merge.
+
+/**
+ * 1. **Runs**: fill a chunk buffer from the input, point an Array at its
+ *    records, sort it with `sorter`, and write it to an unlinked temporary
+ *    file. Records cut off at the end of the buffer move to the front of the
+ *    next chunk. Input that fits in one chunk goes straight to the output.
+ *    With more than one thread there are two chunk buffers: one worker
+ *    sorts and spills a chunk while another reads the next one.
+ * 2. **Passes**: while there are more runs than one merge can give a
+ *    buffer to (fan-in), merge consecutive groups of runs into longer runs.
+ *    Consecutive groups keep equal keys in input order.
+ * 3. **Merge**: k buffered readers feed a loser tree; each output record
+ *    costs ⌈log2 k⌉ key comparisons and no key() calls beyond one per record.
+ *
+ *   input ──chunk──▶ sort ──▶ run 0 ┐
+ *         ──chunk──▶ sort ──▶ run 1 ├──loser tree──▶ output
+ *         ──chunk──▶ sort ──▶ run 2 ┘
+ *
+ * All I/O is sequential, in buffers of up to EXTERNAL_SORT_MAX_IO_BUFFER.
+ */
+
+#define EXTERNAL_PREFIX_SIZE sizeof(uint32_t)
+
+// Per-record scratch of the default sorter: key cache + keyed scratch
+#define EXTERNAL_KEY_CACHE_COST (2 * sizeof(KeyedItem))
+
+typedef struct external_format {
+    size_t record_size;  // 0 = length-prefixed
+    key_val_func key;
+} ExternalFormat;
+
+/**
+ * Default chunk sort: stable, and keys are read once per record instead of
+ * once per comparison (records sit behind pointers, so each key() is a
+ * cache miss once the chunk outgrows the caches). Parallel merge sort when
+ * there are threads to spare, else the adaptive sort.
+ */
+static void externalSortChunk(
+    Array *chunk,
+    const ExternalFormat *format,
+    const ExternalSortConfig *config,
+    const size_t threads
+) {
+    if (config->sorter) config->sorter(chunk, format->key);
+    else if (threads > 1) arrayParallelMergeSort(chunk, format->key, threads);
+    else arraySort(chunk, format->key, BDS_SORT_STABLE);
+}
+
+/// ===============================================================
+/// Raw I/O
+/// ===============================================================
+
+/**
+ * Reads until `length` bytes or end of file. Returns the bytes read, or -1.
+ */
+static ssize_t externalReadFull(const int fd, char *buffer, const size_t length) {
+    size_t total = 0;
+
+    while (total < length) {
+        const ssize_t got = read(fd, buffer + total, length - total);
+
+        if (got == 0) break;  // End of file
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+
+        total += (size_t)got;
+    }
+
+    return (ssize_t)total;
+}
+
+static bool externalWriteFull(const int fd, const char *buffer, size_t length) {
+    while (length > 0) {
+        const ssize_t put = write(fd, buffer, length);
+
+        if (put < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+
+        buffer += put;
+        length -= (size_t)put;
+    }
+
+    return true;
+}
+
+/**
+ * Creates a temporary file and unlinks it at once: it lives until closed.
+ */
+static int externalTempFile(const char *temp_dir) {
+    if (!temp_dir) temp_dir = getenv("TMPDIR");
+    if (!temp_dir || !*temp_dir) temp_dir = "/tmp";
+
+    char path[4096];
+    const int written = snprintf(path, sizeof(path), "%s/bds-sort-XXXXXX", temp_dir);
+    if (written < 0 || (size_t)written >= sizeof(path)) return -1;
+
+    const int fd = mkstemp(path);
+    if (fd < 0) return -1;
+
+    unlink(path);
+    return fd;
+}
+
+static void externalAdviseSequential(const int fd) {
+#ifdef POSIX_FADV_SEQUENTIAL
+    (void)posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);  // A hint; pipes and ttys refuse it
+#else
+    (void)fd;
+#endif
+}
+
+/// ===============================================================
+/// Buffered writer
+/// ===============================================================
+
+typedef struct external_writer {
+    int fd;
+    char *buffer;
+    size_t capacity;
+    size_t used;
+    bool failed;
+} ExternalWriter;
+
+static bool writerFlush(ExternalWriter *writer) {
+    if (!writer->failed && writer->used > 0) {
+        writer->failed = !externalWriteFull(writer->fd, writer->buffer, writer->used);
+    }
+
+    writer->used = 0;
+    return !writer->failed;
+}
+
+static void writerPut(ExternalWriter *writer, const char *bytes, const size_t length) {
+    if (length > writer->capacity - writer->used) writerFlush(writer);
+
+    if (length > writer->capacity) {
+        // Larger than the whole buffer: write it through
+        if (!writer->failed) writer->failed = !externalWriteFull(writer->fd, bytes, length);
+        return;
+    }
+
+    memcpy(writer->buffer + writer->used, bytes, length);
+    writer->used += length;
+}
+
+/**
+ * Writes the records of a sorted chunk, prefixes included.
+ */
+static bool writerPutChunk(ExternalWriter *writer, const Array *chunk, const ExternalFormat *format) {
+    for (size_t idx = 0; idx < chunk->length; idx++) {
+        const char *record = (const char *)chunk->data[idx];
+
+        if (format->record_size > 0) {
+            writerPut(writer, record, format->record_size);
+        } else {
+            uint32_t length;
+            memcpy(&length, record - EXTERNAL_PREFIX_SIZE, EXTERNAL_PREFIX_SIZE);
+            writerPut(writer, record - EXTERNAL_PREFIX_SIZE, EXTERNAL_PREFIX_SIZE + length);
+        }
+    }
+
+    return writerFlush(writer);
+}
+
+/// ===============================================================
+/// Run list
+/// ===============================================================
+
+typedef struct external_runs {
+    int *fds;
+    size_t length;
+    size_t capacity;
+} ExternalRuns;
+
+static bool runsPush(ExternalRuns *runs, const int fd) {
+    if (runs->length == runs->capacity) {
+        const size_t capacity = runs->capacity ? runs->capacity * 2 : 16;
+        int *fds = (int *)realloc(runs->fds, capacity * sizeof(int));
+        if (!fds) return false;
+
+        runs->fds = fds;
+        runs->capacity = capacity;
+    }
+
+    runs->fds[runs->length++] = fd;
+    return true;
+}
+
+static void runsClose(ExternalRuns *runs) {
+    for (size_t idx = 0; idx < runs->length; idx++) close(runs->fds[idx]);
+
+    free(runs->fds);
+    runs->fds = NULL;
+    runs->length = runs->capacity = 0;
+}
+
+/// ===============================================================
+/// Phase 1: sorted runs
+/// ===============================================================
+
+/**
+ * Points `chunk` at the complete records in data[0, filled), at most
+ * `max_records`. Returns the bytes they span.
+ */
+static size_t externalParseChunk(
+    char *data,
+    const size_t filled,
+    Array *chunk,
+    const size_t max_records,
+    const ExternalFormat *format
+) {
+    size_t pos = 0;
+    size_t count = 0;
+
+    if (format->record_size > 0) {
+        while (count < max_records && filled - pos >= format->record_size) {
+            chunk->data[count++] = data + pos;
+            pos += format->record_size;
+        }
+    } else {
+        while (count < max_records && filled - pos >= EXTERNAL_PREFIX_SIZE) {
+            uint32_t length;
+            memcpy(&length, data + pos, EXTERNAL_PREFIX_SIZE);
+            if (filled - pos - EXTERNAL_PREFIX_SIZE < length) break;  // Cut off: next chunk
+
+            chunk->data[count++] = data + pos + EXTERNAL_PREFIX_SIZE;
+            pos += EXTERNAL_PREFIX_SIZE + length;
+        }
+    }
+
+    chunk->length = count;
+    return pos;
+}
+
+typedef struct external_chunk {
+    char *data;
+    void **pointers;
+    Array records;  // Parsed records of data[0, used)
+    size_t filled;  // Bytes in data
+    size_t used;    // Bytes the parsed records span; the rest is carried over
+    bool at_end;    // The read stopped short: end of input
+} ExternalChunk;
+
+typedef struct external_stage {
+    int in_fd;
+    const ExternalFormat *format;
+    const ExternalSortConfig *config;
+    size_t threads;        // For the chunk sort
+    size_t data_capacity;  // Bytes per chunk
+    size_t max_records;    // Records per chunk
+
+    ExternalChunk *spill;  // Sorted, then written out by `writer`
+    ExternalWriter writer;
+    bool spill_ok;
+
+    ExternalChunk *next;   // Read after spill's carry-over; NULL = input exhausted
+    bool read_ok;
+} ExternalStage;
+
+/**
+ * Copies the bytes `from` did not parse to the front of `to` (the same
+ * chunk with one buffer), fills the rest from the input and parses it.
+ */
+static bool externalReadChunk(const ExternalStage *stage, const ExternalChunk *from, ExternalChunk *to) {
+    const size_t carry = from->filled - from->used;
+    memmove(to->data, from->data + from->used, carry);
+
+    const ssize_t got = externalReadFull(stage->in_fd, to->data + carry, stage->data_capacity - carry);
+    if (got < 0) return false;
+
+    to->filled = carry + (size_t)got;
+    to->at_end = to->filled < stage->data_capacity;
+
+    to->records.data = to->pointers;
+    to->used = externalParseChunk(to->data, to->filled, &to->records, stage->max_records, stage->format);
+
+    return true;
+}
+
+/**
+ * Sorts and spills the current chunk, reads the next. A team of two does
+ * both at once: the spill only reads its chunk's bytes and permutes its
+ * pointers, and the reader only copies the carry-over out of it. A team of
+ * one spills first, so the carry-over may land in the same buffer.
+ */
+static void externalStageWorker(void *ctx, const ParallelWorker *worker) {
+    ExternalStage *stage = (ExternalStage *)ctx;
+
+    if (worker->count == 1 || worker->idx == 1) {
+        externalSortChunk(&stage->spill->records, stage->format, stage->config, stage->threads);
+        stage->spill_ok = writerPutChunk(&stage->writer, &stage->spill->records, stage->format);
+    }
+
+    if ((worker->count == 1 || worker->idx == 0) && stage->next) {
+        stage->read_ok = externalReadChunk(stage, stage->spill, stage->next);
+    }
+}
+
+/**
+ * Splits the input into sorted runs. If it all fits in one chunk, it is
+ * written to out_fd directly and *direct is set. false on any failure.
+ */
+static bool externalMakeRuns(
+    const int in_fd,
+    const int out_fd,
+    const ExternalFormat *format,
+    const ExternalSortConfig *config,
+    const size_t budget,
+    const size_t io_size,
+    ExternalRuns *runs,
+    bool *direct
+) {
+    // Two chunk buffers overlap reading with sorting, if there is a second thread
+    const size_t threads = parallelThreadCount(config->nthreads);
+    const size_t buffers = threads > 1 ? 2 : 1;
+
+    // Chunk = record bytes + a pointer per record, per buffer; the key cache
+    // of the one chunk being sorted comes on top. Length-prefixed records
+    // have unknown sizes: the per-record part gets a quarter.
+    const size_t chunk_budget = budget - io_size;
+    const size_t record_cost = buffers * sizeof(void *) + (config->sorter ? 0 : EXTERNAL_KEY_CACHE_COST);
+    size_t data_capacity, max_records;
+
+    if (format->record_size > 0) {
+        max_records = chunk_budget / (buffers * format->record_size + record_cost);
+        data_capacity = max_records * format->record_size;
+    } else {
+        max_records = chunk_budget / 4 / record_cost;
+        data_capacity = (chunk_budget - max_records * record_cost) / buffers;
+    }
+
+    if (max_records == 0) return false;  // Budget below one record
+
+    ExternalChunk chunks[2] = { { NULL, NULL, { NULL, 0 }, 0, 0, false }, { NULL, NULL, { NULL, 0 }, 0, 0, false } };
+    char *io_buffer = (char *)malloc(io_size);
+    bool ok = io_buffer != NULL;
+
+    for (size_t idx = 0; idx < buffers; idx++) {
+        chunks[idx].data = (char *)malloc(data_capacity);
+        chunks[idx].pointers = (void **)malloc(max_records * sizeof(void *));
+        ok = ok && chunks[idx].data && chunks[idx].pointers;
+    }
+
+    ExternalStage stage = {
+        in_fd, format, config, threads, data_capacity, max_records,
+        NULL, { -1, io_buffer, io_size, 0, false }, true,
+        NULL, true,
+    };
+
+    ExternalChunk *current = &chunks[0];
+    if (ok) ok = externalReadChunk(&stage, current, current);  // Nothing to carry yet
+
+    while (ok) {
+        if (current->filled == 0) break;  // Empty input, or the last chunk ended exactly here
+
+        // Nothing parsed: truncated record, or one larger than the chunk
+        if (current->records.length == 0) {
+            ok = false;
+            break;
+        }
+
+        // Everything in one chunk: no runs, no temporary files
+        const bool last = current->at_end && current->used == current->filled;
+        const int fd = last && runs->length == 0 ? out_fd : externalTempFile(config->temp_dir);
+        if (fd < 0) {
+            ok = false;
+            break;
+        }
+
+        if (fd == out_fd) {
+            *direct = true;
+        } else if (!runsPush(runs, fd)) {
+            close(fd);
+            ok = false;
+            break;
+        }
+
+        ExternalChunk *next = &chunks[((size_t)(current - chunks) + 1) % buffers];
+
+        stage.spill = current;
+        stage.writer = (ExternalWriter){ fd, io_buffer, io_size, 0, false };
+        stage.next = last ? NULL : next;
+
+        parallelRun(last ? 1 : buffers, externalStageWorker, &stage);
+
+        ok = stage.spill_ok && stage.read_ok;
+        if (last) break;
+
+        current = next;
+    }
+
+    for (size_t idx = 0; idx < buffers; idx++) {
+        free(chunks[idx].data);
+        free(chunks[idx].pointers);
+    }
+    free(io_buffer);
+
+    return ok;
+}
+
+/// ===============================================================
+/// Phase 2: k-way merge
+/// ===============================================================
+
+typedef struct external_reader {
+    int fd;
+    char *buffer;
+    size_t capacity;
+    size_t begin;         // Current record's first byte (prefix included)
+    size_t end;           // Bytes in the buffer
+    bool at_end;          // The file has no more bytes past `end`
+
+    size_t record_bytes;  // Current record's size on disk; 0 = none
+    int key;
+} ExternalReader;
+
+/**
+ * Makes `length` bytes from `begin` available. false if the file ends first.
+ */
+static bool readerEnsure(ExternalReader *reader, const size_t length, bool *failed) {
+    if (reader->end - reader->begin >= length) return true;
+    if (reader->at_end && reader->begin == reader->end) return false;
+
+    // Tail to the front, grow for records larger than the buffer, refill
+    memmove(reader->buffer, reader->buffer + reader->begin, reader->end - reader->begin);
+    reader->end -= reader->begin;
+    reader->begin = 0;
+
+    if (length > reader->capacity) {
+        char *grown = (char *)realloc(reader->buffer, length);
+        if (!grown) {
+            *failed = true;
+            return false;
+        }
+
+        reader->buffer = grown;
+        reader->capacity = length;
+    }
+
+    if (!reader->at_end) {
+        const ssize_t got = externalReadFull(reader->fd, reader->buffer + reader->end, reader->capacity - reader->end);
+        if (got < 0) {
+            *failed = true;
+            return false;
+        }
+
+        reader->end += (size_t)got;
+        reader->at_end = reader->end < reader->capacity;
+    }
+
+    if (reader->end >= length) return true;
+
+    if (reader->end > 0) *failed = true;  // Truncated record
+    return false;
+}
+
+/**
+ * Steps past the current record. false when the run is exhausted (or on
+ * failure, then *failed is set).
+ */
+static bool readerAdvance(ExternalReader *reader, const ExternalFormat *format, bool *failed) {
+    reader->begin += reader->record_bytes;
+    reader->record_bytes = 0;
+
+    size_t length = format->record_size;
+
+    if (length == 0) {
+        if (!readerEnsure(reader, EXTERNAL_PREFIX_SIZE, failed)) return false;
+
+        uint32_t payload;
+        memcpy(&payload, reader->buffer + reader->begin, EXTERNAL_PREFIX_SIZE);
+        length = EXTERNAL_PREFIX_SIZE + payload;
+
+        if (!readerEnsure(reader, length, failed)) {
+            *failed = true;  // The prefix promised more bytes
+            return false;
+        }
+    } else if (!readerEnsure(reader, length, failed)) {
+        return false;
+    }
+
+    const size_t offset = format->record_size > 0 ? 0 : EXTERNAL_PREFIX_SIZE;
+
+    reader->record_bytes = length;
+    reader->key = format->key(reader->buffer + reader->begin + offset);
+    return true;
+}
+
+/**
+ * Loser tree order: live runs by key, ties to the earlier run (stable);
+ * exhausted runs last.
+ */
+static inline bool runBefore(const ExternalReader *readers, const size_t a, const size_t b) {
+    if (readers[a].record_bytes == 0) return false;
+    if (readers[b].record_bytes == 0) return true;
+
+    return readers[a].key < readers[b].key || (readers[a].key == readers[b].key && a < b);
+}
+
+/**
+ * Merges the k runs in fds[0, k), read from their start, into out_fd.
+ */
+static bool externalMerge(
+    const int *fds,
+    const size_t k,
+    const int out_fd,
+    const ExternalFormat *format,
+    const size_t budget
+) {
+    // Each reader and the writer get an equal share of the budget
+    size_t io_size = budget / (k + 1);
+    if (io_size < EXTERNAL_SORT_MIN_IO_BUFFER) io_size = EXTERNAL_SORT_MIN_IO_BUFFER;
+    if (io_size > EXTERNAL_SORT_MAX_IO_BUFFER) io_size = EXTERNAL_SORT_MAX_IO_BUFFER;
+
+    ExternalReader *readers = (ExternalReader *)calloc(k, sizeof(ExternalReader));
+    size_t *tree = (size_t *)malloc(k * sizeof(size_t));  // [0] winner, [1, k) losers; leaf i is node k + i
+    char *out_buffer = (char *)malloc(io_size);
+
+    bool failed = !readers || !tree || !out_buffer;
+
+    for (size_t idx = 0; !failed && idx < k; idx++) {
+        readers[idx].fd = fds[idx];
+        readers[idx].buffer = (char *)malloc(io_size);
+        readers[idx].capacity = io_size;
+
+        if (!readers[idx].buffer || lseek(fds[idx], 0, SEEK_SET) < 0) {
+            failed = true;
+            break;
+        }
+
+        externalAdviseSequential(fds[idx]);
+        readerAdvance(&readers[idx], format, &failed);
+    }
+
+    if (!failed) {
+        // Play every match bottom-up: the loser stays at the node, the winner moves on
+        size_t *winners = (size_t *)malloc(2 * k * sizeof(size_t));
+        failed = !winners;
+
+        if (winners) {
+            for (size_t idx = 0; idx < k; idx++) winners[k + idx] = idx;
+
+            for (size_t node = k - 1; node >= 1; node--) {
+                const size_t left = winners[2 * node];
+                const size_t right = winners[2 * node + 1];
+                const bool left_wins = runBefore(readers, left, right);
+
+                winners[node] = left_wins ? left : right;
+                tree[node] = left_wins ? right : left;
+            }
+
+            tree[0] = k > 1 ? winners[1] : 0;
+            free(winners);
+        }
+    }
+
+    ExternalWriter writer = { out_fd, out_buffer, io_size, 0, false };
+
+    while (!failed && readers[tree[0]].record_bytes > 0) {
+        size_t winner = tree[0];
+        ExternalReader *reader = &readers[winner];
+
+        writerPut(&writer, reader->buffer + reader->begin, reader->record_bytes);
+        readerAdvance(reader, format, &failed);
+
+        // Replay the winner's path: it plays each stored loser on the way up
+        for (size_t node = (winner + k) >> 1; node >= 1; node >>= 1) {
+            if (runBefore(readers, tree[node], winner)) {
+                const size_t swap_tmp = tree[node];
+                tree[node] = winner;
+                winner = swap_tmp;
+            }
+        }
+
+        tree[0] = winner;
+        failed = failed || writer.failed;
+    }
+
+    if (!failed) failed = !writerFlush(&writer);
+
+    if (readers) {
+        for (size_t idx = 0; idx < k; idx++) free(readers[idx].buffer);
+    }
+
+    free(readers);
+    free(tree);
+    free(out_buffer);
+
+    return !failed;
+}
+
+/**
+ * Merges groups of `fan_in` consecutive runs into single runs until one
+ * merge can take them all.
+ */
+static bool externalMergePasses(
+    ExternalRuns *runs,
+    const size_t fan_in,
+    const ExternalFormat *format,
+    const ExternalSortConfig *config,
+    const size_t budget
+) {
+    while (runs->length > fan_in) {
+        ExternalRuns merged = { NULL, 0, 0 };
+        bool ok = true;
+
+        for (size_t lo = 0; ok && lo < runs->length; lo += fan_in) {
+            const size_t k = runs->length - lo < fan_in ? runs->length - lo : fan_in;
+
+            const int fd = externalTempFile(config->temp_dir);
+            ok = fd >= 0 && runsPush(&merged, fd);
+            if (fd >= 0 && !ok) close(fd);
+
+            if (ok) ok = externalMerge(&runs->fds[lo], k, fd, format, budget);
+        }
+
+        runsClose(runs);
+        *runs = merged;
+
+        if (!ok) return false;
+    }
+
+    return true;
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+bool arrayExternalSort(const int in_fd, const int out_fd, const key_val_func key, const ExternalSortConfig *config) {
+    /*
+    EXTERNAL-SORT(in, out, key, M)            // M = memory budget in bytes
+        runs ← ∅
+        C ← as many records of in as fit in M (M / 2 with threads: two chunks)
+        while C has records do
+            if runs = ∅ and in is exhausted then
+                SORT(C, key) ; write C to out ; return     // fits in memory
+            in parallel
+                SORT(C, key) ; write C to a new temporary file R
+                C' ← the next records of in
+            runs ← runs ∪ {R} ; C ← C'
+
+        F ← fan-in: how many runs get a buffer from M
+        while |runs| > F do
+            runs ← [ MERGE(runs[i..i+F)) into a new temporary file
+                     for i ← 0, F, 2F, ... ]
+
+        MERGE(runs) into out
+
+    MERGE(R_0 .. R_{k−1}) into W
+        T ← loser tree over the head record of every R_i
+        while T's winner w is not exhausted do
+            write head(R_w) to W
+            advance R_w ; replay w's leaf-to-root path in T
+    */
+
+    /* Time Complexity Analysis:
+       Let n = records, N = bytes, M = budget, p = threads,
+       r = ⌈N / M⌉ runs (⌈2N / M⌉ when p > 1),
+       F = fan-in (up to EXTERNAL_SORT_MAX_FAN_IN), B = I/O buffer.
+
+       Runs:    r chunk sorts of n/r records ⇒ Θ(n log(n/r)) comparisons,
+                spread over p threads; reading chunk i + 1 overlaps
+                sorting and writing chunk i.
+       Merges:  ⌈log_F r⌉ passes (1 unless r > F), each Θ(n log F) comparisons.
+
+       T(n) = Θ(n log n)   comparisons, one key() per record per pass
+
+       I/O:     N read + N written per phase, in sequential B-byte requests:
+                2N · (1 + ⌈log_F r⌉) bytes, Θ(N / B) system calls per pass.
+
+       𝒪[T(n)]
+        = 𝒪[n log n]
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = M + F   (chunk or merge buffers, loser tree), independent of n.
+                      With threads M holds two chunks, each with half the records.
+       Disk: N bytes of runs (2N during an extra merge pass).
+
+       𝒪[m(n)]
+        = 𝒪[M]
+    */
+
+    if (in_fd < 0 || out_fd < 0 || !key) return false;
+
+    ExternalSortConfig settings = { 0, 0, NULL, NULL, 0 };
+    if (config) settings = *config;
+    if (!settings.memory_budget) settings.memory_budget = EXTERNAL_SORT_DEFAULT_BUDGET;
+
+    const ExternalFormat format = { settings.record_size, key };
+
+    // One write buffer while making runs; the rest of the budget holds the chunk
+    size_t io_size = settings.memory_budget / 16;
+    if (io_size < EXTERNAL_SORT_MIN_IO_BUFFER) io_size = EXTERNAL_SORT_MIN_IO_BUFFER;
+    if (io_size > EXTERNAL_SORT_MAX_IO_BUFFER) io_size = EXTERNAL_SORT_MAX_IO_BUFFER;
+
+    const size_t budget = settings.memory_budget > 2 * io_size ? settings.memory_budget : 2 * io_size;
+
+    size_t fan_in = budget / io_size - 1;
+    if (fan_in > EXTERNAL_SORT_MAX_FAN_IN) fan_in = EXTERNAL_SORT_MAX_FAN_IN;
+    if (fan_in < 2) fan_in = 2;
+
+    externalAdviseSequential(in_fd);
+
+    ExternalRuns runs = { NULL, 0, 0 };
+    bool direct = false;
+
+    bool ok = externalMakeRuns(in_fd, out_fd, &format, &settings, budget, io_size, &runs, &direct);
+
+    if (ok && !direct && runs.length > 0) {
+        ok = externalMergePasses(&runs, fan_in, &format, &settings, budget);
+        if (ok) ok = externalMerge(runs.fds, runs.length, out_fd, &format, budget);
+    }
+
+    runsClose(&runs);
+    return ok;
+}
@@ -2,13 +2,16 @@
 
 #include "../../../include/bds/array/bds_array_utils.h"
 #include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_sort_context.h"
+#include "../../internal/bds_sort_kernels.h"
+#include "../../internal/bds_sort_network.h"
+#include "../../internal/bds_tuning.h"  // INTRO_LEAF_THRESHOLD
 
 /**
- * IntroSort ~= QuickSort + HeapSort + InsertionSort
+ * IntroSort ~= QuickSort + HeapSort + sorting networks (leaves)
  */
 
-#define INTRO_INSERTION_THRESHOLD 16
-
 // ===============================================================
 // Utility: integer log2 for size_t
 // ===============================================================
@@ -28,38 +31,6 @@ static size_t introLog2Size(size_t n) {
     return result;
 }
 
-// ===============================================================
-// Insertion Sort (for tiny partitions)
-// ===============================================================
-
-/**
- * Insertion sort over [lo, hi).
- * Stable and efficient for small, almost-sorted ranges.
- */
-static void introInsertionSort(
-    Array *array,
-    const size_t lo,
-    const size_t hi,
-    const key_val_func key
-) {
-    if (hi - lo < 2) return;
-
-    for (size_t i = lo + 1; i < hi; i++) {
-        void *pivot = arrayGet(array, i);
-        size_t j = i;
-
-        // Shift elements greater than pivot to the right
-        while (j > lo &&
-               arrayKeyCompare(arrayGet(array, j - 1), pivot, key) > 0) {
-
-            arraySet(array, j, arrayGet(array, j - 1));
-            j--;
-        }
-
-        arraySet(array, j, pivot);
-    }
-}
-
 // ===============================================================
 // HeapSort fallback (max-heap) for depth limit
 // ===============================================================
@@ -68,7 +39,7 @@ static void introInsertionSort(
  * Sifts a node down the heap to restore the max-heap property.
  * Heap range is [heap_lo, heap_hi).
  */
-static void introHeapSiftDown(
+void sortKernelHeapSiftDown(
     Array *array,
     size_t root,
     const size_t heap_lo,
@@ -101,9 +72,9 @@ static void introHeapSiftDown(
 
 /**
  * HeapSort over [lo, hi).
- * Used only as a safe fallback when QuickSort recursion is too deep.
+ * Used as a safe fallback when QuickSort recursion is too deep.
  */
-static void introHeapSortRange(
+void sortKernelHeapSortRange(
     Array *array,
     const size_t lo,
     const size_t hi,
@@ -115,29 +86,47 @@ static void introHeapSortRange(
     // Build max-heap in [lo, hi)
     // Last parent = lo + (length / 2) - 1
     for (size_t i = lo + (length >> 1); i-- > lo; ) {
-        introHeapSiftDown(array, i, lo, hi, key);
+        sortKernelHeapSiftDown(array, i, lo, hi, key);
     }
 
     // Extract max repeatedly and shrink heap
     for (size_t end = hi; end-- > lo + 1; ) {
         arraySwap(array, lo, end);
-        introHeapSiftDown(array, lo, lo, end, key);
+        sortKernelHeapSiftDown(array, lo, lo, end, key);
     }
 }
 
 // ===============================================================
-// QuickSort partition (median-of-three)
+// QuickSort partition (median-of-three, 3-way Bentley-McIlroy)
 // ===============================================================
 
 /**
- * Partitions [lo, hi) around a median-of-three pivot.
- * Returns the final pivot index in [lo, hi).
+ * Swaps the blocks [idx1, idx1 + count) and [idx2, idx2 + count).
+ */
+static void introSwapBlocks(Array *array, const size_t idx1, const size_t idx2, const size_t count) {
+    for (size_t k = 0; k < count; k++) {
+        arraySwap(array, idx1 + k, idx2 + k);
+    }
+}
+
+/**
+ * Partitions [lo, hi) around a median-of-three pivot into
+ *     [lo, *eq_lo) < pivot, [*eq_lo, *eq_hi) == pivot, [*eq_hi, hi) > pivot.
+ *
+ * Bentley-McIlroy: a two-pointer scan like Hoare's, except that keys equal
+ * to the pivot are parked at both ends and swapped into the middle at the
+ * end. Distinct keys cost no extra swaps; duplicates are never recursed into.
+ *
+ *   [ == | <  |  ?  |  > | == ]   →   [  <  |   ==   |  >  ]
+ *   lo   p    i     j    q   hi
  */
-static size_t introPartition(
+static void introPartition(
     Array *array,
     const size_t lo,
     const size_t hi,
-    const key_val_func key
+    const key_val_func key,
+    size_t *eq_lo,
+    size_t *eq_hi
 ) {
     const size_t mid = lo + ((hi - lo) >> 1);
     const size_t hi_1 = hi - 1;
@@ -152,36 +141,58 @@ static size_t introPartition(
     if (arrayKeyCompare(arrayGet(array, hi_1), arrayGet(array, mid), key) < 0)
         arraySwap(array, mid, hi_1);
 
-    // Use mid as pivot; move it near the end (hi-2)
-    const size_t pivot_idx_tmp = hi_1 - 1;
-    arraySwap(array, mid, pivot_idx_tmp);
-
-    const void *pivot = arrayGet(array, pivot_idx_tmp);
+    // Use mid as pivot; move it to lo, the start of the left "==" block
+    arraySwap(array, lo, mid);
+    const void *pivot = arrayGet(array, lo);
 
-    size_t i = lo;
-    size_t j = pivot_idx_tmp;
+    size_t left_eq  = lo + 1;  // [lo, left_eq)    == pivot
+    size_t right_eq = hi_1;    // (right_eq, hi_1] == pivot
+    size_t i = lo + 1;
+    size_t j = hi_1;
 
     while (1) {
-        while (i < pivot_idx_tmp &&
-               arrayKeyCompare(arrayGet(array, i), pivot, key) < 0) {
+        while (i <= j) {
+            const int cmp = arrayKeyCompare(arrayGet(array, i), pivot, key);
+            if (cmp > 0) break;
+
+            if (cmp == 0) {
+                arraySwap(array, left_eq, i);
+                left_eq++;
+            }
             i++;
         }
 
-        while (j > lo &&
-               arrayKeyCompare(arrayGet(array, j), pivot, key) > 0) {
+        while (i <= j) {
+            const int cmp = arrayKeyCompare(arrayGet(array, j), pivot, key);
+            if (cmp < 0) break;
+
+            if (cmp == 0) {
+                arraySwap(array, j, right_eq);
+                right_eq--;
+            }
             j--;
         }
 
-        if (i >= j) break;
+        if (i > j) break;
 
         arraySwap(array, i, j);
         i++;
         j--;
     }
 
-    // Place pivot in its final position
-    arraySwap(array, i, pivot_idx_tmp);
-    return i;
+    // Now [lo, left_eq) ==, [left_eq, i) <, [i, right_eq] >, (right_eq, hi) ==
+    const size_t less_count = i - left_eq;
+    const size_t more_count = right_eq + 1 - i;
+
+    // Move both "==" blocks into the middle
+    const size_t left_move  = left_eq - lo < less_count ? left_eq - lo : less_count;
+    const size_t right_move = hi_1 - right_eq < more_count ? hi_1 - right_eq : more_count;
+
+    introSwapBlocks(array, lo, i - left_move, left_move);
+    introSwapBlocks(array, i, hi - right_move, right_move);
+
+    *eq_lo = lo + less_count;
+    *eq_hi = hi - more_count;
 }
 
 // ===============================================================
@@ -199,38 +210,48 @@ static void introSortRecursive(
     size_t depth_limit,
     const key_val_func key
 ) {
-    while (hi - lo > INTRO_INSERTION_THRESHOLD) {
+    while (hi - lo > INTRO_LEAF_THRESHOLD) {
         if (depth_limit == 0) {
             // Fallback to heapsort on this range
-            introHeapSortRange(array, lo, hi, key);
+            sortKernelHeapSortRange(array, lo, hi, key);
             return;
         }
 
         depth_limit--;
 
-        const size_t pivot_idx = introPartition(array, lo, hi, key);
+        size_t eq_lo, eq_hi;
+        introPartition(array, lo, hi, key, &eq_lo, &eq_hi);
 
-        // Tail-recursion optimization: recurse on smaller half first
-        // and loop on the larger half.
-        if (pivot_idx - lo < hi - (pivot_idx + 1)) {
+        // Tail-recursion optimization: recurse on smaller side first
+        // and loop on the larger side. [eq_lo, eq_hi) is already final.
+        if (eq_lo - lo < hi - eq_hi) {
             // Left side smaller
-            introSortRecursive(array, lo, pivot_idx, depth_limit, key);
-            // Continue on right side
-            // lo = pivot_idx + 1;
-            // hi stays the same
-            lo = pivot_idx + 1;
+            introSortRecursive(array, lo, eq_lo, depth_limit, key);
+            lo = eq_hi;
         } else {
             // Right side smaller
-            introSortRecursive(array, pivot_idx + 1, hi, depth_limit, key);
-            // Continue on left side
-            // hi = pivot_idx;
-            // lo stays the same
-            hi = pivot_idx;
+            introSortRecursive(array, eq_hi, hi, depth_limit, key);
+            hi = eq_lo;
         }
     }
 
-    // Small range → insertion sort
-    introInsertionSort(array, lo, hi, key);
+    // Small range → sorting network
+    sortNetworkSortRange(array, lo, hi, key);
+}
+
+size_t sortKernelIntroDepthLimit(const size_t length) {
+    return 2u * introLog2Size(length);
+}
+
+void sortKernelIntroSortRange(
+    Array *array,
+    const size_t lo,
+    const size_t hi,
+    const key_val_func key
+) {
+    if (hi - lo < 2) return;
+
+    introSortRecursive(array, lo, hi, sortKernelIntroDepthLimit(hi - lo), key);
 }
 
 // ===============================================================
@@ -249,26 +270,26 @@ void arrayIntroSort(
 
     INTRO-SORT-REC(A, lo, hi, depth_limit, key)
         // sorts A[lo..hi) (hi is exclusive)
-        while (hi − lo) > INTRO_INSERTION_THRESHOLD do
+        while (hi − lo) > INTRO_LEAF_THRESHOLD do
             if depth_limit = 0 then
                 HEAP-SORT-RANGE(A, lo, hi, key)     // safe fallback
                 return
 
             depth_limit ← depth_limit − 1
 
-            p ← PARTITION-MEDIAN3(A, lo, hi, key)
+            (lt, gt) ← PARTITION-MEDIAN3-3WAY(A, lo, hi, key)   // A[lt..gt) = pivot
 
             // Tail recursion optimization:
             // recurse into smaller side, iterate on larger side
-            if (p − lo) < (hi − (p + 1)) then
-                INTRO-SORT-REC(A, lo, p, depth_limit, key)
-                lo ← p + 1
+            if (lt − lo) < (hi − gt) then
+                INTRO-SORT-REC(A, lo, lt, depth_limit, key)
+                lo ← gt
             else
-                INTRO-SORT-REC(A, p + 1, hi, depth_limit, key)
-                hi ← p
+                INTRO-SORT-REC(A, gt, hi, depth_limit, key)
+                hi ← lt
 
-        // small range → insertion sort
-        INSERTION-SORT-RANGE(A, lo, hi, key)
+        // small range → sorting network
+        NETWORK-SORT-RANGE(A, lo, hi, key)
 
     LOG2-SIZE(n)
         // returns ⌊log2(n)⌋ for n ≥ 1
@@ -278,14 +299,13 @@ void arrayIntroSort(
             r ← r + 1
         return r
 
-    INSERTION-SORT-RANGE(A, lo, hi, key)
-        for i ← lo + 1 to hi − 1 do
-            x ← A[i]
-            j ← i
-            while j > lo and key(A[j − 1]) > key(x) do
-                A[j] ← A[j − 1]
-                j ← j − 1
-            A[j] ← x
+    NETWORK-SORT-RANGE(A, lo, hi, key)
+        // leaf kernel, hi − lo ≤ 16: one key() call per element, no branches
+        for i ← 0 to hi − lo − 1 do
+            r[i] ← (key(A[lo + i]), i)      // unique rank ⇒ stable
+        apply the fixed comparator network for size hi − lo to r
+            // each step: r[a], r[b] ← min(r[a], r[b]), max(r[a], r[b])
+        A[lo..hi) ← [A[lo + r[i].i] for i ← 0 to hi − lo − 1]
 
     PARTITION-MEDIAN3(A, lo, hi, key)
         mid ← lo + ⌊(hi − lo)/2⌋
@@ -296,30 +316,36 @@ void arrayIntroSort(
         if key(A[last]) < key(A[lo]) then swap(A[lo], A[last])
         if key(A[last]) < key(A[mid]) then swap(A[mid], A[last])
 
-        // move pivot near end, then two-pointer partition
-        pivot_tmp ← last − 1
-        swap(A[mid], A[pivot_tmp])
-        pivot ← A[pivot_tmp]
+        // move pivot to lo, then Bentley-McIlroy two-pointer partition
+        swap(A[lo], A[mid])
+        pivot ← A[lo]
 
-        i ← lo
-        j ← pivot_tmp
+        p ← lo + 1 ; q ← last        // A[lo..p) = pivot = A(q..last]
+        i ← lo + 1 ; j ← last
 
         while true do
-            while i < pivot_tmp and key(A[i]) < key(pivot) do
+            while i ≤ j and key(A[i]) ≤ key(pivot) do
+                if key(A[i]) = key(pivot) then
+                    swap(A[p], A[i]) ; p ← p + 1
                 i ← i + 1
 
-            while j > lo and key(A[j]) > key(pivot) do
+            while i ≤ j and key(A[j]) ≥ key(pivot) do
+                if key(A[j]) = key(pivot) then
+                    swap(A[j], A[q]) ; q ← q − 1
                 j ← j − 1
 
-            if i ≥ j then
+            if i > j then
                 break
 
             swap(A[i], A[j])
             i ← i + 1
             j ← j − 1
 
-        swap(A[i], A[pivot_tmp])     // pivot to final position
-        return i
+        // [lo, p) =, [p, i) <, [i, q] >, (q, hi) =  → move the = blocks inward
+        less ← i − p ; more ← q + 1 − i
+        SWAP-BLOCKS(A, lo, i − min(p − lo, less), min(p − lo, less))
+        SWAP-BLOCKS(A, i, hi − min(last − q, more), min(last − q, more))
+        return (lo + less, hi − more)
 
     HEAP-SORT-RANGE(A, lo, hi, key)
         len ← hi − lo
@@ -363,7 +389,7 @@ void arrayIntroSort(
          - QuickSort (fast average) with median-of-three pivots,
          - a recursion depth limit (≈ 2*log2(n)),
          - and HeapSort fallback to guarantee worst-case bounds,
-         - plus insertion sort for small partitions.
+         - plus sorting networks for small partitions.
 
        Average-case:
          QuickSort dominates with good pivots:
@@ -384,7 +410,12 @@ void arrayIntroSort(
          Balanced partitions + linear partition work per level:
            T_best(n) = Θ(n log n)
 
-       The insertion-sort threshold improves constants (tiny ranges) but does not
+       Duplicate keys (k distinct values):
+         The 3-way partition removes every copy of the pivot value from the
+         recursion, so only the k distinct values are ever split:
+           T(n) = Θ(n log k)      (all keys equal ⇒ one Θ(n) scan)
+
+       The sorting-network leaf threshold improves constants (tiny ranges) but does not
        change the asymptotic bounds.
     */
 
@@ -398,7 +429,7 @@ void arrayIntroSort(
          therefore the maximum call stack depth remains O(log n).
 
        HeapSort fallback is iterative over the range (no extra array).
-       Insertion sort uses constant locals.
+       The leaf networks use fixed-size locals (≤ 64 ranks).
 
        𝒪[m(n)]
         = 𝒪[log n]
@@ -421,9 +452,7 @@ void arrayIntroSort(
     if (length < 2) return;
 
     // Depth limit ~ 2 * floor(log2(n))
-    const size_t depth_limit = 2u * introLog2Size(length);
-
-    introSortRecursive(array, 0, length, depth_limit, key);
+    introSortRecursive(array, 0, length, sortKernelIntroDepthLimit(length), key);
 }
 
 Array *arrayIntroSorted(
@@ -436,3 +465,206 @@ Array *arrayIntroSorted(
     arrayIntroSort(sorted_array, key);
     return sorted_array;
 }
+
+// ===============================================================
+// Keyed IntroSort (operates on a key cache, no key() calls)
+// ===============================================================
+
+static void keyedSwap(KeyedItem *items, const size_t idx1, const size_t idx2) {
+    BDS_STATS_ADD(swaps, 1);
+
+    const KeyedItem temp = items[idx1];
+    items[idx1] = items[idx2];
+    items[idx2] = temp;
+}
+
+static void keyedHeapSiftDown(
+    KeyedItem *items,
+    size_t root,
+    const size_t heap_lo,
+    const size_t heap_hi
+) {
+    while (1) {
+        const size_t left  = heap_lo + ((root - heap_lo) * 2u + 1u);
+        const size_t right = left + 1u;
+
+        if (left >= heap_hi) break;
+
+        size_t largest = root;
+
+        if (KEYED_CMP(items[left].key > items[largest].key)) largest = left;
+        if (right < heap_hi && KEYED_CMP(items[right].key > items[largest].key)) largest = right;
+
+        if (largest == root) break;
+
+        keyedSwap(items, root, largest);
+        root = largest;
+    }
+}
+
+void keyedHeapSortRange(KeyedItem *items, const size_t lo, const size_t hi) {
+    const size_t length = hi - lo;
+    if (length < 2) return;
+
+    for (size_t i = lo + (length >> 1); i-- > lo; ) {
+        keyedHeapSiftDown(items, i, lo, hi);
+    }
+
+    for (size_t end = hi; end-- > lo + 1; ) {
+        keyedSwap(items, lo, end);
+        keyedHeapSiftDown(items, lo, lo, end);
+    }
+}
+
+static void keyedSwapBlocks(KeyedItem *items, const size_t idx1, const size_t idx2, const size_t count) {
+    for (size_t k = 0; k < count; k++) {
+        keyedSwap(items, idx1 + k, idx2 + k);
+    }
+}
+
+/**
+ * Same 3-way median-of-three partition as introPartition(), on cached keys.
+ */
+void keyedIntroPartition(
+    KeyedItem *items,
+    const size_t lo,
+    const size_t hi,
+    size_t *eq_lo,
+    size_t *eq_hi
+) {
+    const size_t mid  = lo + ((hi - lo) >> 1);
+    const size_t hi_1 = hi - 1;
+
+    if (KEYED_CMP(items[mid].key  < items[lo].key))  keyedSwap(items, lo, mid);
+    if (KEYED_CMP(items[hi_1].key < items[lo].key))  keyedSwap(items, lo, hi_1);
+    if (KEYED_CMP(items[hi_1].key < items[mid].key)) keyedSwap(items, mid, hi_1);
+
+    keyedSwap(items, lo, mid);
+    const int pivot = items[lo].key;
+
+    size_t left_eq  = lo + 1;
+    size_t right_eq = hi_1;
+    size_t i = lo + 1;
+    size_t j = hi_1;
+
+    while (1) {
+        while (i <= j && KEYED_CMP(items[i].key <= pivot)) {
+            if (KEYED_CMP(items[i].key == pivot)) {
+                keyedSwap(items, left_eq, i);
+                left_eq++;
+            }
+            i++;
+        }
+
+        while (i <= j && KEYED_CMP(items[j].key >= pivot)) {
+            if (KEYED_CMP(items[j].key == pivot)) {
+                keyedSwap(items, j, right_eq);
+                right_eq--;
+            }
+            j--;
+        }
+
+        if (i > j) break;
+
+        keyedSwap(items, i, j);
+        i++;
+        j--;
+    }
+
+    const size_t less_count = i - left_eq;
+    const size_t more_count = right_eq + 1 - i;
+
+    const size_t left_move  = left_eq - lo < less_count ? left_eq - lo : less_count;
+    const size_t right_move = hi_1 - right_eq < more_count ? hi_1 - right_eq : more_count;
+
+    keyedSwapBlocks(items, lo, i - left_move, left_move);
+    keyedSwapBlocks(items, i, hi - right_move, right_move);
+
+    *eq_lo = lo + less_count;
+    *eq_hi = hi - more_count;
+}
+
+void keyedIntroSortRange(
+    KeyedItem *items,
+    size_t lo,
+    size_t hi,
+    size_t depth_limit
+) {
+    while (hi - lo > INTRO_LEAF_THRESHOLD) {
+        if (depth_limit == 0) {
+            keyedHeapSortRange(items, lo, hi);
+            return;
+        }
+
+        depth_limit--;
+
+        size_t eq_lo, eq_hi;
+        keyedIntroPartition(items, lo, hi, &eq_lo, &eq_hi);
+
+        if (eq_lo - lo < hi - eq_hi) {
+            keyedIntroSortRange(items, lo, eq_lo, depth_limit);
+            lo = eq_hi;
+        } else {
+            keyedIntroSortRange(items, eq_hi, hi, depth_limit);
+            hi = eq_lo;
+        }
+    }
+
+    keyedNetworkSort(items + lo, hi - lo);
+}
+
+size_t keyedIntroDepthLimit(const size_t length) {
+    return sortKernelIntroDepthLimit(length);
+}
+
+void keyedIntroSort(KeyedItem *items, const size_t length) {
+    if (length < 2) return;
+
+    keyedIntroSortRange(items, 0, length, keyedIntroDepthLimit(length));
+}
+
+void arrayIntroSortCached(Array *array, const key_val_func key) {
+    /*
+    INTRO-SORT-CACHED(A, key)
+        C ← [(key(A[i]), A[i]) for i ← 0 to n − 1]   // n key() calls
+        INTRO-SORT(C, λc. c.key)                      // integer compares only
+        for i ← 0 to n − 1 do
+            A[i] ← C[i].ptr
+    */
+
+    /* Time:   𝒪[n log n] compares, exactly n key() calls.
+       Memory: m(n) = n (key, ptr) pairs + log n stack ⇒ 𝒪[n]
+    */
+
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayIntroSortCachedCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayIntroSortCachedCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayIntroSortCached(array, key);
+        return;
+    }
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    KeyedItem *items = sortContextKeyCache(ctx, array, key);
+    if (!items) {
+        arrayIntroSort(array, key);  // No room for the cache: in place, key() per comparison
+        return;
+    }
+
+    keyedIntroSort(items, length);
+    keyCacheWriteBack(array, items);
+}
+
+Array *arrayIntroSortedCached(const Array *array, const key_val_func key) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayIntroSortCached(sorted_array, key);
+    return sorted_array;
+}
@@ -0,0 +1,165 @@
+/// Key-cached sorting (decorate-sort-undecorate) | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+
+#include <stdlib.h>
+
+/**
+ * 1. **Decorate**: call key(A[i]) once per element and store (key, A[i]) in a
+ *    contiguous buffer. Payloads are prefetched a few slots ahead so the
+ *    dereference inside key() rarely misses.
+ * 2. **Sort**: sort the compact buffer. Comparisons read an int that sits next
+ *    to its pointer; no more indirect calls or payload cache misses.
+ * 3. **Undecorate**: write the pointers back into A in their new order.
+ *
+ * key() calls drop from O(n log n) to exactly n.
+ */
+
+/// ===============================================================
+/// Key cache helpers
+/// ===============================================================
+
+void keyCacheFill(KeyedItem *items, const Array *array, const key_val_func key) {
+    const size_t length = arrayLength(array);
+    BDS_STATS_ADD(key_calls, length);
+
+    for (size_t i = 0; i < length; i++) {
+        if (i + KEY_CACHE_PREFETCH_DISTANCE < length) {
+            BDS_PREFETCH(array->data[i + KEY_CACHE_PREFETCH_DISTANCE]);
+        }
+
+        void *datapoint = array->data[i];
+
+        items[i].key = key(datapoint);
+        items[i].ptr = datapoint;
+    }
+}
+
+KeyedItem *keyCacheNew(const Array *array, const key_val_func key) {
+    const size_t length = arrayLength(array);
+    if (length == 0) return NULL;
+
+    KeyedItem *items = (KeyedItem *)malloc(length * sizeof(KeyedItem));
+    if (!items) return NULL;
+
+    keyCacheFill(items, array, key);
+
+    return items;
+}
+
+void keyCacheWriteBack(Array *array, const KeyedItem *items) {
+    const size_t length = arrayLength(array);
+    BDS_STATS_ADD(writes, length);
+
+    for (size_t i = 0; i < length; i++) {
+        array->data[i] = items[i].ptr;
+    }
+}
+
+/**
+ * Stable insertion sort over a keyed buffer.
+ */
+void keyedInsertionSort(KeyedItem *items, const size_t length) {
+    for (size_t i = 1; i < length; i++) {
+        const KeyedItem pivot = items[i];
+        size_t j = i;
+
+        while (j > 0 && KEYED_CMP(items[j - 1].key > pivot.key)) {
+            BDS_STATS_ADD(writes, 1);
+            items[j] = items[j - 1];
+            j--;
+        }
+
+        items[j] = pivot;
+    }
+}
+
+/// ===============================================================
+/// Generic cached adapter (works with any array_sort_func)
+/// ===============================================================
+
+// Proxy elements point into the key cache, so the "key function" is a load.
+static int keyCacheProxyKey(const void *elem) {
+    return ((const KeyedItem *)elem)->key;
+}
+
+void arraySortCached(Array *array, const key_val_func key, const array_sort_func sorter) {
+    /*
+    SORT-CACHED(A, key, SORT)
+        n ← length(A)
+        if n < 2 then
+            return
+
+        C ← new array of n (key, ptr) pairs
+        for i ← 0 to n − 1 do
+            C[i] ← (key(A[i]), A[i])            // only call to key()
+
+        P ← new array of n pointers
+        for i ← 0 to n − 1 do
+            P[i] ← &C[i]
+
+        SORT(P, λp. p.key)                       // any algorithm, stability kept
+
+        for i ← 0 to n − 1 do
+            A[i] ← P[i].ptr
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), T_s(n) the cost of SORT.
+
+         T(n) = n (key calls) + T_s(n) + 2n (proxy setup + write-back)
+
+       𝒪[T(n)]
+        = 𝒪[T_s(n)]
+
+       key() is called exactly n times regardless of SORT, unless C or P
+       cannot be allocated: then SORT runs on A itself.
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = n pairs + n pointers + m_s(n)
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2 || !sorter) return;
+
+    // No room for the cache or the proxies: sort the Array itself (key() per comparison)
+    KeyedItem *items = keyCacheNew(array, key);
+    if (!items) {
+        sorter(array, key);
+        return;
+    }
+
+    Array *proxy = arrayNew(length);
+    if (!proxy) {
+        free(items);
+        sorter(array, key);
+        return;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        proxy->data[i] = &items[i];
+    }
+
+    sorter(proxy, keyCacheProxyKey);
+
+    for (size_t i = 0; i < length; i++) {
+        array->data[i] = ((const KeyedItem *)proxy->data[i])->ptr;
+    }
+
+    arrayFree(proxy);
+    free(items);
+}
+
+Array *arraySortedCached(const Array *array, const key_val_func key, const array_sort_func sorter) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arraySortCached(sorted_array, key, sorter);
+
+    return sorted_array;
+}
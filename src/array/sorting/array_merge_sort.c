@@ -1,8 +1,10 @@
 /// Merge Sort O(n log n) | LST+ARR
 
 #include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_sort_context.h"
 
-#include <stdlib.h>
+#include <string.h>  // memcpy
 
 // No clue how this one works...
 static void merge(
@@ -27,6 +29,10 @@ static void merge(
         const int left_key  = key(left_elem);
         const int right_key = key(right_elem);
 
+        BDS_STATS_ADD(key_calls, 2);
+        BDS_STATS_ADD(compares, 1);
+        BDS_STATS_ADD(writes, 1);  // temp[temp_idx]
+
         if (left_key <= right_key) {
             temp[temp_idx++] = left_elem;
             left_half_idx++;
@@ -37,6 +43,8 @@ static void merge(
         }
     }
 
+    BDS_STATS_ADD(writes, (mid - left_half_idx) + (right - right_half_idx));
+
     // Copy what's left in the left half
     while (left_half_idx < mid) {
         temp[temp_idx++] = arrayGet(array, left_half_idx++);
@@ -164,14 +172,25 @@ void arrayMergeSort(Array *array, const key_val_func key) {
         = 𝒪[n]
     */
 
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayMergeSortCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayMergeSortCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayMergeSort(array, key);
+        return;
+    }
+
     const size_t length = arrayLength(array);
     if (length < 2) return;
 
-    void **temp = (void **)malloc(length * sizeof(void *));
+    void **temp = sortContextPointers(ctx, length);
     if (!temp) return;  // Memory allocation failed
 
     mergeSortRecursive(array, temp, 0, length, key);
-    free(temp);
 }
 
 Array *arrayMergeSorted(const Array *array, const key_val_func key) {
@@ -183,3 +202,278 @@ Array *arrayMergeSorted(const Array *array, const key_val_func key) {
     return sorted_array;
 }
 
+/// ===============================================================
+/// Bottom-up (ping-pong) merge sort
+/// ===============================================================
+
+/**
+ * Same merges as arrayMergeSort, without the copy back:
+ *
+ * 1. **Blocks**: insertion sort blocks of BOTTOM_UP_MERGE_BLOCK elements in place.
+ * 2. **Levels**: merge neighbouring runs of width w = 32, 64, ... from `src`
+ *    into `dst`, then swap the roles of the two buffers. Every level reads
+ *    and writes each element once (top-down merge + copy back: twice).
+ * 3. **Ordered pairs**: if the last key of the left run <= the first key of
+ *    the right run, the pair is already merged: that check costs two key()
+ *    calls, and the pair is then copied without calling key() again.
+ * 4. **Finish**: if the last level landed in `temp`, copy it back once.
+ *
+ *   level:   A ──merge──▶ T ──merge──▶ A ──merge──▶ T ──copy──▶ A
+ */
+
+#define BOTTOM_UP_MERGE_BLOCK 32
+
+/**
+ * Insertion sort over data[lo, hi); the pivot's key is computed once.
+ */
+static void bottomUpInsertionSort(void **data, const size_t lo, const size_t hi, const key_val_func key) {
+    for (size_t i = lo + 1; i < hi; i++) {
+        void *pivot = data[i];
+        const int pivot_key = key(pivot);
+
+        size_t scan_idx = i;
+
+        BDS_STATS_ADD(key_calls, 1);
+
+        while (scan_idx > lo) {
+            BDS_STATS_ADD(key_calls, 1);
+            if (!KEYED_CMP(key(data[scan_idx - 1]) > pivot_key)) break;
+
+            BDS_STATS_ADD(writes, 1);
+            data[scan_idx] = data[scan_idx - 1];
+            scan_idx--;
+        }
+
+        BDS_STATS_ADD(writes, 1);
+        data[scan_idx] = pivot;
+    }
+}
+
+/**
+ * Stable merge of src[lo, mid) and src[mid, hi) into dst[lo, hi).
+ * Each element's key is computed once per merge.
+ */
+static void bottomUpMergeRuns(
+    void *const *src,
+    void **dst,
+    const size_t lo,
+    const size_t mid,
+    const size_t hi,
+    const key_val_func key
+) {
+    BDS_STATS_ADD(writes, hi - lo);  // Every element lands in dst once
+
+    // Lone run, or the two runs are already in order: plain copy
+    if (mid >= hi || (BDS_STATS_ADD(key_calls, 2), KEYED_CMP(key(src[mid - 1]) <= key(src[mid])))) {
+        memcpy(&dst[lo], &src[lo], (hi - lo) * sizeof(void *));
+        return;
+    }
+
+    size_t left_idx  = lo;
+    size_t right_idx = mid;
+    size_t write_idx = lo;
+
+    int left_key  = key(src[left_idx]);
+    int right_key = key(src[right_idx]);
+
+    BDS_STATS_ADD(key_calls, 2);
+
+    while (1) {
+        BDS_STATS_ADD(key_calls, 1);  // The refill below (one short on the last round)
+
+        if (KEYED_CMP(left_key <= right_key)) {
+            dst[write_idx++] = src[left_idx++];  // Stable: left wins ties
+            if (left_idx == mid) break;
+            left_key = key(src[left_idx]);
+        } else {
+            dst[write_idx++] = src[right_idx++];
+            if (right_idx == hi) break;
+            right_key = key(src[right_idx]);
+        }
+    }
+
+    memcpy(&dst[write_idx], &src[left_idx], (mid - left_idx) * sizeof(void *));
+    write_idx += mid - left_idx;
+    memcpy(&dst[write_idx], &src[right_idx], (hi - right_idx) * sizeof(void *));
+}
+
+void arrayBottomUpMergeSort(Array *array, const key_val_func key) {
+    /*
+    BOTTOM-UP-MERGE-SORT(A, key)
+        n ← length(A)
+        if n < 2 then
+            return
+
+        for lo ← 0 to n − 1 step 32 do
+            INSERTION-SORT(A, lo, min(lo + 32, n), key)
+
+        src ← A ; dst ← T                     // T = scratch of size n
+        for width ← 32, 64, 128, ... while width < n do
+            for lo ← 0 to n − 1 step 2·width do
+                mid ← min(lo + width, n)
+                hi  ← min(lo + 2·width, n)
+
+                if mid = hi or key(src[mid − 1]) ≤ key(src[mid]) then
+                    dst[lo..hi) ← src[lo..hi)  // already ordered
+                else
+                    MERGE(src[lo..mid), src[mid..hi)) → dst[lo..hi)
+
+            swap(src, dst)                    // no copy back per level
+
+        if src ≠ A then
+            A ← src                           // single copy back
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), b = 32.
+
+       Blocks:  n/b insertion sorts of b elements ⇒ Θ(n · b) worst, Θ(n) sorted.
+       Levels:  ⌈log2(n/b)⌉ levels, Θ(n) each.
+
+       T(n) = Θ(n log n)   worst / average
+       Already sorted: every pair is "ordered", so the levels cost 2 key()
+       calls per pair (Θ(n / b) in total) on top of the blocks' Θ(n):
+         key() calls:     Θ(n)
+         pointer moves:   Θ(n log(n/b))   (each level still copies its n pointers)
+
+       Memory traffic: each level moves n pointers once (arrayMergeSort: twice),
+       plus at most one final n-pointer copy.
+
+       𝒪[T(n)]
+        = 𝒪[n log n]
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = n   (scratch; no recursion)
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayBottomUpMergeSortCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayBottomUpMergeSortCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayBottomUpMergeSort(array, key);
+        return;
+    }
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    for (size_t lo = 0; lo < length; lo += BOTTOM_UP_MERGE_BLOCK) {
+        const size_t hi = length - lo < BOTTOM_UP_MERGE_BLOCK ? length : lo + BOTTOM_UP_MERGE_BLOCK;
+        bottomUpInsertionSort(array->data, lo, hi, key);
+    }
+
+    if (length <= BOTTOM_UP_MERGE_BLOCK) return;
+
+    void **temp = sortContextPointers(ctx, length);
+    if (!temp) return;  // Memory allocation failed (blocks stay sorted)
+
+    void **src = array->data;
+    void **dst = temp;
+
+    for (size_t width = BOTTOM_UP_MERGE_BLOCK; width < length; width <<= 1) {
+        for (size_t lo = 0; lo < length; lo += width << 1) {
+            const size_t mid = length - lo < width ? length : lo + width;
+            const size_t hi  = length - mid < width ? length : mid + width;
+
+            bottomUpMergeRuns(src, dst, lo, mid, hi, key);
+        }
+
+        void **swap_tmp = src;
+        src = dst;
+        dst = swap_tmp;
+    }
+
+    if (src != array->data) {
+        BDS_STATS_ADD(writes, length);
+        memcpy(array->data, src, length * sizeof(void *));
+    }
+}
+
+Array *arrayBottomUpMergeSorted(const Array *array, const key_val_func key) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayBottomUpMergeSort(sorted_array, key);
+
+    return sorted_array;
+}
+
+/// ===============================================================
+/// Keyed merge sort (operates on a key cache, caller-owned buffer)
+/// ===============================================================
+
+#define KEYED_MERGE_BLOCK 32
+
+/**
+ * Stable merge of src[lo, mid) and src[mid, hi) into dst[lo, hi).
+ */
+static void keyedMergeRuns(
+    const KeyedItem *src,
+    KeyedItem *dst,
+    const size_t lo,
+    const size_t mid,
+    const size_t hi
+) {
+    BDS_STATS_ADD(writes, hi - lo);  // Every item lands in dst once
+
+    // Lone run, or the two runs are already in order: plain copy
+    if (mid >= hi || KEYED_CMP(src[mid - 1].key <= src[mid].key)) {
+        memcpy(&dst[lo], &src[lo], (hi - lo) * sizeof(KeyedItem));
+        return;
+    }
+
+    size_t left_idx  = lo;
+    size_t right_idx = mid;
+    size_t write_idx = lo;
+
+    while (left_idx < mid && right_idx < hi) {
+        if (KEYED_CMP(src[right_idx].key < src[left_idx].key)) dst[write_idx++] = src[right_idx++];
+        else dst[write_idx++] = src[left_idx++];
+    }
+
+    memcpy(&dst[write_idx], &src[left_idx], (mid - left_idx) * sizeof(KeyedItem));
+    write_idx += mid - left_idx;
+    memcpy(&dst[write_idx], &src[right_idx], (hi - right_idx) * sizeof(KeyedItem));
+}
+
+/**
+ * Bottom-up stable merge sort. `scratch` must hold `length` items;
+ * the result always ends up in `items`.
+ */
+void keyedMergeSort(KeyedItem *items, KeyedItem *scratch, const size_t length) {
+    if (length < 2) return;
+
+    for (size_t lo = 0; lo < length; lo += KEYED_MERGE_BLOCK) {
+        const size_t block_len = length - lo < KEYED_MERGE_BLOCK ? length - lo : KEYED_MERGE_BLOCK;
+        keyedInsertionSort(items + lo, block_len);
+    }
+
+    KeyedItem *src = items;
+    KeyedItem *dst = scratch;
+
+    for (size_t width = KEYED_MERGE_BLOCK; width < length; width <<= 1) {
+        for (size_t lo = 0; lo < length; lo += width << 1) {
+            const size_t mid = length - lo < width ? length : lo + width;
+            const size_t hi  = length - mid < width ? length : mid + width;
+
+            keyedMergeRuns(src, dst, lo, mid, hi);
+        }
+
+        KeyedItem *swap_tmp = src;
+        src = dst;
+        dst = swap_tmp;
+    }
+
+    if (src != items) {
+        BDS_STATS_ADD(writes, length);
+        memcpy(items, src, length * sizeof(KeyedItem));
+    }
+}
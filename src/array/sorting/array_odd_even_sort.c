@@ -2,6 +2,12 @@
 
 #include "../../../include/bds/array/bds_array_sort.h"
 #include "../../../include/bds/array/bds_array_utils.h"
+#include "../../../include/bds/bds_config.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_parallel.h"
+
+#include <stdlib.h>
+#include <string.h>  // memcpy
 
 void arrayOddEvenSort(Array *array, const key_val_func key) {
     // Odd-Even Sort (also known as Brick Sort) is a variation of bubble sort.
@@ -246,4 +252,358 @@ Array *arrayOddEvenSorted(const Array *array, key_val_func key) {
     arrayOddEvenSort(sorted_array, key);
 
     return sorted_array;
-}
\ No newline at end of file
+}
+
+/// ===============================================================
+/// Parallel odd-even transposition sort
+/// ===============================================================
+
+/**
+ * Every pair of a phase is independent, so each phase is split across the
+ * team and the workers meet at a barrier before the next one:
+ *
+ *   odd phase:   (1,2) (3,4) (5,6) (7,8)      worker 0: first half of the pairs
+ *   ──────────── barrier ─────────────          worker 1: second half
+ *   even phase:  (0,1) (2,3) (4,5) (6,7)
+ *   ──────────── barrier ─────────────  → stop when no worker swapped
+ *
+ * Workers compare cached keys (one key() per element, up front) and swap
+ * KeyedItems. Each worker reports "swapped" in its own slot; slots
+ * alternate between two rows by round, so a row is only rewritten after
+ * every worker has read it.
+ */
+
+typedef struct parallel_odd_even_ctx {
+    Array *array;
+    KeyedItem *items;
+    KeyedItem *scratch;  // Block variant: merge-split output
+    size_t length;
+    bool *swapped;       // [2][team size] "changed something" flags
+} ParallelOddEvenCtx;
+
+static void parallelOddEvenWorker(void *arg, const ParallelWorker *worker) {
+    ParallelOddEvenCtx *ctx = (ParallelOddEvenCtx *)arg;
+    KeyedItem *items = ctx->items;
+
+    for (size_t round = 0;; round++) {
+        bool swapped = false;
+
+        for (size_t first = 1;; first = 0) {  // odd phase, then even phase
+            const size_t pairs = (ctx->length - first) >> 1;
+
+            size_t pair_lo, pair_hi;
+            parallelSplit(pairs, worker, &pair_lo, &pair_hi);
+
+            for (size_t pair = pair_lo; pair < pair_hi; pair++) {
+                const size_t idx = first + 2 * pair;
+
+                if (items[idx].key > items[idx + 1].key) {
+                    const KeyedItem swap_tmp = items[idx];
+                    items[idx] = items[idx + 1];
+                    items[idx + 1] = swap_tmp;
+                    swapped = true;
+                }
+            }
+
+            if (first == 0) break;
+            parallelSync(worker);
+        }
+
+        bool *flags = ctx->swapped + (round & 1) * worker->count;
+        flags[worker->idx] = swapped;
+
+        parallelSync(worker);
+
+        bool any_swapped = false;
+        for (size_t idx = 0; idx < worker->count; idx++) any_swapped |= flags[idx];
+
+        if (!any_swapped) return;
+    }
+}
+
+void arrayParallelOddEvenSort(Array *array, const key_val_func key, const size_t nthreads) {
+    /*
+    PARALLEL-ODD-EVEN-SORT(A, key, p)
+        n ← length(A)
+        C ← [(key(A[i]), A[i]) for i ∈ [0, n)]
+
+        parallel for w ← 0 to p − 1 do
+            repeat
+                swapped ← false
+                for first ∈ {1, 0} do               // odd phase, even phase
+                    for each pair k of the phase in SLICE(pairs, p, w) do
+                        i ← first + 2k
+                        if C[i].key > C[i + 1].key then
+                            swap(C[i], C[i + 1]) ; swapped ← true
+                    BARRIER
+                flag[w] ← swapped
+                BARRIER
+            until no flag is set
+
+        A ← C.ptr
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), p = workers. At most n phases (n/2 rounds).
+
+       Per phase: (n/2) / p compare-exchanges + one barrier.
+
+         T(n, p) = n · (n / 2p + barrier)      worst / average
+         T(n, p) = n / p + barrier             already sorted (one round)
+
+       𝒪[T(n, p)]
+        = 𝒪[n² / p]
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = n pairs + 2p flags + p thread stacks
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    const size_t team_size = parallelTeamSize(length, parallelThreadCount(nthreads), PARALLEL_MIN_CHUNK_LENGTH);
+
+    ParallelOddEvenCtx ctx;
+    ctx.array   = array;
+    ctx.length  = length;
+    ctx.scratch = NULL;
+    ctx.items   = keyCacheNew(array, key);
+    ctx.swapped = (bool *)malloc(2 * team_size * sizeof(bool));
+
+    if (ctx.items && ctx.swapped) {
+        parallelRun(team_size, parallelOddEvenWorker, &ctx);
+        keyCacheWriteBack(array, ctx.items);
+    } else {
+        arrayOddEvenSort(array, key);  // Memory allocation failed: serial, in place
+    }
+
+    free(ctx.swapped);
+    free(ctx.items);
+}
+
+Array *arrayParallelOddEvenSorted(const Array *array, const key_val_func key, const size_t nthreads) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayParallelOddEvenSort(sorted_array, key, nthreads);
+
+    return sorted_array;
+}
+
+/// ===============================================================
+/// Block odd-even transposition sort (merge-split)
+/// ===============================================================
+
+/**
+ * The same lock-step schedule with a block of n/p elements per worker in
+ * place of a single element:
+ *
+ * 1. **Local sort**: every worker sorts its block (stable TimSort on keys).
+ * 2. **Phases**: in phase t the blocks pair up as (b, b + 1) with
+ *    b ≡ t (mod 2). A pair is merge-split: the lower block keeps the
+ *    smallest |lower| elements of the two, the upper one the rest. Both
+ *    partners work at once: the lower worker merges forward and stops
+ *    after |lower| outputs, the upper one merges backward. Pairs already
+ *    in order (last of lower <= first of upper) are left alone. Two phases
+ *    in a row without a merge-split mean every block boundary is in order:
+ *    done. That takes at most p phases (+2 to notice), often fewer.
+ *
+ *   blocks:  [B0][B1][B2][B3]     phase 0: B0⇄B1  B2⇄B3
+ *                                 phase 1:    B1⇄B2
+ *                                 ...
+ *
+ * Merge-splits keep equal keys in order, so the sort is stable.
+ */
+
+/**
+ * First `count` outputs of the stable merge of left[0, left_len) and
+ * right[0, right_len), into out.
+ */
+static void blockMergeLow(
+    const KeyedItem *left,
+    const size_t left_len,
+    const KeyedItem *right,
+    const size_t right_len,
+    KeyedItem *out,
+    const size_t count
+) {
+    size_t left_idx = 0;
+    size_t right_idx = 0;
+
+    for (size_t write_idx = 0; write_idx < count; write_idx++) {
+        if (right_idx >= right_len || (left_idx < left_len && left[left_idx].key <= right[right_idx].key)) {
+            out[write_idx] = left[left_idx++];  // Stable: left wins ties
+        } else {
+            out[write_idx] = right[right_idx++];
+        }
+    }
+}
+
+/**
+ * Last `count` outputs of the same merge, into out[0, count).
+ */
+static void blockMergeHigh(
+    const KeyedItem *left,
+    const size_t left_len,
+    const KeyedItem *right,
+    const size_t right_len,
+    KeyedItem *out,
+    const size_t count
+) {
+    size_t left_idx = left_len;    // one past the next left element
+    size_t right_idx = right_len;  // one past the next right element
+
+    for (size_t write_idx = count; write_idx > 0; write_idx--) {
+        if (left_idx == 0 || (right_idx > 0 && left[left_idx - 1].key <= right[right_idx - 1].key)) {
+            out[write_idx - 1] = right[--right_idx];  // Stable: from the back, right wins ties
+        } else {
+            out[write_idx - 1] = left[--left_idx];
+        }
+    }
+}
+
+static void parallelBlockOddEvenWorker(void *arg, const ParallelWorker *worker) {
+    ParallelOddEvenCtx *ctx = (ParallelOddEvenCtx *)arg;
+    KeyedItem *items = ctx->items;
+
+    const size_t length = ctx->length;
+    const size_t blocks = worker->count;
+    const size_t block  = worker->idx;
+
+    size_t lo, hi;
+    parallelSplit(length, worker, &lo, &hi);
+
+    // 1) Local sort
+    keyedTimSortWith(items + lo, ctx->scratch + lo, hi - lo);
+    parallelSync(worker);
+
+    // 2) Merge-split phases, until two in a row change nothing
+    bool previous_exchanged = true;
+
+    for (size_t phase = 0;; phase++) {
+        const bool is_lower = ((block ^ phase) & 1) == 0;  // I pair with block + 1
+        bool exchanged = false;
+
+        if (is_lower && block + 1 < blocks) {
+            const size_t partner_hi = parallelSplitAt(length, blocks, block + 2);
+
+            if (items[hi - 1].key > items[hi].key) {
+                blockMergeLow(items + lo, hi - lo, items + hi, partner_hi - hi, ctx->scratch + lo, hi - lo);
+                exchanged = true;
+            }
+        } else if (!is_lower && block > 0) {
+            const size_t partner_lo = parallelSplitAt(length, blocks, block - 1);
+
+            if (items[lo - 1].key > items[lo].key) {
+                blockMergeHigh(items + partner_lo, lo - partner_lo, items + lo, hi - lo, ctx->scratch + lo, hi - lo);
+                exchanged = true;
+            }
+        }
+
+        bool *flags = ctx->swapped + (phase & 1) * blocks;
+        flags[block] = exchanged;
+
+        parallelSync(worker);  // Partners have read both blocks
+
+        if (exchanged) memcpy(items + lo, ctx->scratch + lo, (hi - lo) * sizeof(KeyedItem));
+
+        parallelSync(worker);
+
+        bool any_exchanged = false;
+        for (size_t idx = 0; idx < blocks; idx++) any_exchanged |= flags[idx];
+
+        if (!any_exchanged && !previous_exchanged) break;  // Every boundary in order
+        previous_exchanged = any_exchanged;
+    }
+
+    // 3) Undecorate my block
+    for (size_t idx = lo; idx < hi; idx++) {
+        ctx->array->data[idx] = items[idx].ptr;
+    }
+}
+
+void arrayParallelBlockOddEvenSort(Array *array, const key_val_func key, const size_t nthreads) {
+    /*
+    PARALLEL-BLOCK-ODD-EVEN-SORT(A, key, p)
+        n ← length(A)
+        C ← [(key(A[i]), A[i]) for i ∈ [0, n)] ; T ← new array of n pairs
+
+        parallel for b ← 0 to p − 1 do
+            [lo, hi) ← SLICE(n, p, b)
+            TIM-SORT(C[lo..hi))                      // stable
+            BARRIER
+
+            for t ← 0, 1, 2, ... until two phases in a row exchange nothing do
+                if b ≡ t (mod 2) and b + 1 < p then  // lower block of a pair
+                    if C[hi − 1].key > C[hi].key then
+                        T[lo..hi) ← first hi − lo of MERGE(block b, block b + 1)
+                else if b > 0 then                   // upper block of a pair
+                    if C[lo − 1].key > C[lo].key then
+                        T[lo..hi) ← last hi − lo of MERGE(block b − 1, block b)
+                BARRIER
+                C[lo..hi) ← T[lo..hi) if it was written
+                BARRIER
+
+            A[lo..hi) ← C[lo..hi).ptr
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), p = workers, m = n/p (block length).
+
+       Local sorts:  m log m
+       Phases:       p merge-splits of 2m elements, split between the two
+                     partners: Θ(m) each (Θ(1) for pairs already in order)
+
+         T(n, p) = (n/p) log(n/p) + p · (n/p) + 2p · barrier
+                 = (n/p) log(n/p) + n
+
+       The p phases move every element up to p blocks, so the merge-splits
+       add Θ(n) per worker whatever p is: the lock-step schedule trades that
+       for nearest-neighbour-only communication.
+
+       𝒪[T(n, p)]
+        = 𝒪[(n/p) log(n/p) + n]
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = 2n pairs + 2p flags + p thread stacks
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    const size_t team_size = parallelTeamSize(length, parallelThreadCount(nthreads), PARALLEL_MIN_CHUNK_LENGTH);
+
+    ParallelOddEvenCtx ctx;
+    ctx.array   = array;
+    ctx.length  = length;
+    ctx.items   = keyCacheNew(array, key);
+    ctx.scratch = (KeyedItem *)malloc(length * sizeof(KeyedItem));
+    ctx.swapped = (bool *)malloc(2 * team_size * sizeof(bool));
+
+    if (ctx.items && ctx.scratch && ctx.swapped) {
+        parallelRun(team_size, parallelBlockOddEvenWorker, &ctx);
+    } else {
+        arrayTimSort(array, key);  // Memory allocation failed: serial, stable
+    }
+
+    free(ctx.swapped);
+    free(ctx.scratch);
+    free(ctx.items);
+}
+
+Array *arrayParallelBlockOddEvenSorted(const Array *array, const key_val_func key, const size_t nthreads) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayParallelBlockOddEvenSort(sorted_array, key, nthreads);
+
+    return sorted_array;
+}
@@ -0,0 +1,374 @@
+/// Parallel Intro Sort O(n log n / p) | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../../include/bds/bds_config.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_parallel.h"
+#include "../../internal/bds_task_pool.h"
+
+#include <stdlib.h>
+
+/**
+ * IntroSort's two partitions are independent, so they can be sorted by
+ * different threads.
+ *
+ * 1. **Top levels (whole team)**: the first partitions touch all n elements,
+ *    so they are done by every worker at once. Each worker counts how many
+ *    keys of its slice are <, == and > the pivot, the counts are prefix-summed
+ *    and each worker scatters its slice straight to its final region:
+ *
+ *      [  w0 <  | w1 <  | ... ][ == ][  w0 >  | w1 >  | ... ]
+ *
+ *    Keys equal to the pivot are done after this step.
+ * 2. **Task pool**: each remaining range becomes a task on a work-stealing
+ *    pool. A task partitions its range, spawns the smaller side and keeps
+ *    going on the larger one, until the range is small enough to finish
+ *    serially with keyed IntroSort.
+ * 3. **Depth limit**: every partition (parallel or not) spends one unit of
+ *    the usual 2·⌊log2 n⌋ budget; a range that runs out is heap sorted, so
+ *    adversarial inputs stay O(n log n).
+ */
+
+#define PARALLEL_INTRO_TASK_CUTOFF 8192  // ranges up to this size are not split into tasks
+
+typedef struct parallel_partition_counts {
+    size_t less;
+    size_t equal;
+} ParallelPartitionCounts;
+
+typedef struct parallel_intro_ctx {
+    Array *array;
+    key_val_func key;
+
+    KeyedItem *items;
+    KeyedItem *scratch;
+    size_t length;
+
+    ParallelPartitionCounts *counts;  // one per worker
+
+    // Top-level ranges, double buffered; worker 0 writes the next level
+    RangeTask *ranges[2];
+    size_t range_count;
+    size_t range_capacity;
+} ParallelIntroCtx;
+
+/// ===============================================================
+/// Team partition (3-way)
+/// ===============================================================
+
+static int parallelIntroPivot(const KeyedItem *items, const size_t lo, const size_t hi) {
+    const int a = items[lo].key;
+    const int b = items[lo + ((hi - lo) >> 1)].key;
+    const int c = items[hi - 1].key;
+
+    if (a < b) {
+        if (b < c) return b;
+        return a < c ? c : a;
+    }
+
+    if (a < c) return a;
+    return b < c ? c : b;
+}
+
+/**
+ * Partitions items[lo, hi) with the whole team.
+ * Every worker returns the same [*less_end, *greater_start).
+ */
+static void parallelIntroPartition(
+    ParallelIntroCtx *ctx,
+    const ParallelWorker *worker,
+    const size_t lo,
+    const size_t hi,
+    size_t *less_end,
+    size_t *greater_start
+) {
+    KeyedItem *items   = ctx->items;
+    KeyedItem *scratch = ctx->scratch;
+
+    const int pivot = parallelIntroPivot(items, lo, hi);
+
+    const size_t my_lo = lo + parallelSplitAt(hi - lo, worker->count, worker->idx);
+    const size_t my_hi = lo + parallelSplitAt(hi - lo, worker->count, worker->idx + 1);
+
+    // 1) Count my slice
+    ParallelPartitionCounts mine = { 0, 0 };
+
+    for (size_t i = my_lo; i < my_hi; i++) {
+        mine.less  += items[i].key < pivot;
+        mine.equal += items[i].key == pivot;
+    }
+
+    ctx->counts[worker->idx] = mine;
+    parallelSync(worker);
+
+    // 2) Prefix sums → where my three groups start
+    size_t total_less = 0, total_equal = 0;
+    size_t less_before = 0, equal_before = 0, greater_before = 0;
+
+    for (size_t w = 0; w < worker->count; w++) {
+        const ParallelPartitionCounts other = ctx->counts[w];
+        const size_t other_len = parallelSplitAt(hi - lo, worker->count, w + 1) - parallelSplitAt(hi - lo, worker->count, w);
+
+        total_less  += other.less;
+        total_equal += other.equal;
+
+        if (w < worker->idx) {
+            less_before    += other.less;
+            equal_before   += other.equal;
+            greater_before += other_len - other.less - other.equal;
+        }
+    }
+
+    size_t less_out    = lo + less_before;
+    size_t equal_out   = lo + total_less + equal_before;
+    size_t greater_out = lo + total_less + total_equal + greater_before;
+
+    // 3) Scatter my slice into scratch
+    for (size_t i = my_lo; i < my_hi; i++) {
+        if (items[i].key < pivot) scratch[less_out++] = items[i];
+        else if (items[i].key == pivot) scratch[equal_out++] = items[i];
+        else scratch[greater_out++] = items[i];
+    }
+
+    parallelSync(worker);
+
+    // 4) Copy back my slice
+    for (size_t i = my_lo; i < my_hi; i++) {
+        items[i] = scratch[i];
+    }
+
+    *less_end      = lo + total_less;
+    *greater_start = lo + total_less + total_equal;
+}
+
+/// ===============================================================
+/// Phase 1: cache keys + top-level partitions (team)
+/// ===============================================================
+
+static void parallelIntroTopWorker(void *arg, const ParallelWorker *worker) {
+    ParallelIntroCtx *ctx = (ParallelIntroCtx *)arg;
+
+    size_t slice_lo, slice_hi;
+    parallelSplit(ctx->length, worker, &slice_lo, &slice_hi);
+
+    const Array chunk = { ctx->array->data + slice_lo, slice_hi - slice_lo };
+    keyCacheFill(ctx->items + slice_lo, &chunk, ctx->key);
+
+    parallelSync(worker);
+
+    // ⌈log2 p⌉ levels give about one range per worker
+    size_t levels = 0;
+    while (((size_t)1 << levels) < worker->count) levels++;
+
+    const RangeTask *current = ctx->ranges[0];
+    RangeTask *next = ctx->ranges[1];
+    size_t current_count = ctx->range_count;
+
+    for (size_t level = 0; level < levels; level++) {
+        size_t next_count = 0;
+
+        for (size_t r = 0; r < current_count; r++) {
+            const RangeTask range = current[r];
+
+            if (range.hi - range.lo <= PARALLEL_INTRO_TASK_CUTOFF || range.depth == 0) {
+                if (worker->idx == 0) next[next_count] = range;
+                next_count++;
+                continue;
+            }
+
+            size_t less_end, greater_start;
+            parallelIntroPartition(ctx, worker, range.lo, range.hi, &less_end, &greater_start);
+
+            if (less_end - range.lo > 1) {
+                if (worker->idx == 0) next[next_count] = (RangeTask){ range.lo, less_end, range.depth - 1 };
+                next_count++;
+            }
+
+            if (range.hi - greater_start > 1) {
+                if (worker->idx == 0) next[next_count] = (RangeTask){ greater_start, range.hi, range.depth - 1 };
+                next_count++;
+            }
+        }
+
+        parallelSync(worker);
+
+        RangeTask *swap_tmp = (RangeTask *)current;
+        current = next;
+        next = swap_tmp;
+        current_count = next_count;
+    }
+
+    if (worker->idx == 0) {
+        ctx->ranges[0]   = (RangeTask *)current;
+        ctx->ranges[1]   = next;
+        ctx->range_count = current_count;
+    }
+}
+
+/// ===============================================================
+/// Phase 2: work-stealing IntroSort tasks
+/// ===============================================================
+
+static void parallelIntroTask(void *arg, TaskPoolWorker *worker, const RangeTask task) {
+    ParallelIntroCtx *ctx = (ParallelIntroCtx *)arg;
+    KeyedItem *items = ctx->items;
+
+    size_t lo    = task.lo;
+    size_t hi    = task.hi;
+    size_t depth = task.depth;
+
+    while (hi - lo > PARALLEL_INTRO_TASK_CUTOFF) {
+        if (depth == 0) {
+            keyedHeapSortRange(items, lo, hi);
+            return;
+        }
+
+        depth--;
+
+        size_t eq_lo, eq_hi;
+        keyedIntroPartition(items, lo, hi, &eq_lo, &eq_hi);
+
+        // Hand off the smaller side, keep working on the larger one
+        RangeTask smaller;
+
+        if (eq_lo - lo < hi - eq_hi) {
+            smaller = (RangeTask){ lo, eq_lo, depth };
+            lo = eq_hi;
+        } else {
+            smaller = (RangeTask){ eq_hi, hi, depth };
+            hi = eq_lo;
+        }
+
+        if (smaller.hi - smaller.lo > PARALLEL_INTRO_TASK_CUTOFF) taskPoolSpawn(worker, smaller);
+        else keyedIntroSortRange(items, smaller.lo, smaller.hi, smaller.depth);
+    }
+
+    keyedIntroSortRange(items, lo, hi, depth);
+}
+
+/// ===============================================================
+/// Phase 3: write back (team)
+/// ===============================================================
+
+static void parallelIntroWriteBackWorker(void *arg, const ParallelWorker *worker) {
+    ParallelIntroCtx *ctx = (ParallelIntroCtx *)arg;
+
+    size_t slice_lo, slice_hi;
+    parallelSplit(ctx->length, worker, &slice_lo, &slice_hi);
+
+    for (size_t i = slice_lo; i < slice_hi; i++) {
+        ctx->array->data[i] = ctx->items[i].ptr;
+    }
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+void arrayParallelIntroSort(Array *array, const key_val_func key, const size_t nthreads) {
+    /*
+    PARALLEL-INTRO-SORT(A, key, p)
+        n ← length(A)
+        C ← [(key(A[i]), A[i]) for i ← 0 to n − 1]       // parallel
+        R ← { (0, n, 2·⌊log2 n⌋) }
+
+        repeat ⌈log2 p⌉ times                          // whole team per range
+            R ← ⋃ { TEAM-PARTITION-3WAY(C, r) : r ∈ R }  // drops the == pivot block
+
+        POOL-RUN(p workers, tasks = R, TASK)
+
+        A[i] ← C[i].ptr for all i                      // parallel
+
+    TASK(lo, hi, depth)
+        while hi − lo > CUTOFF do
+            if depth = 0 then
+                HEAP-SORT-RANGE(C, lo, hi) ; return
+            depth ← depth − 1
+            q ← PARTITION-MEDIAN3(C, lo, hi)
+            SPAWN(smaller side of q, depth)           // may be stolen
+            continue on the larger side
+        INTRO-SORT-RANGE(C, lo, hi, depth)
+
+    TEAM-PARTITION-3WAY(C, (lo, hi, depth))
+        pivot ← MEDIAN(C[lo], C[mid], C[hi − 1])
+        each worker w counts <, == in its slice
+        BARRIER
+        offsets ← prefix sums of the counts
+        each worker scatters its slice to T at its offsets
+        BARRIER
+        each worker copies its slice of T back to C
+        return (lo, lo + #<, depth − 1), (lo + #< + #==, hi, depth − 1)
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), p = workers.
+
+       Top levels:  ⌈log2 p⌉ · n/p
+       Tasks:       (n log n)/p expected with good load balance (stealing)
+       Worst case:  the depth limit bounds every range by heap sort ⇒ O(n log n)
+
+       𝒪[T(n, p)]
+        = 𝒪[(n log n) / p]   expected
+        = 𝒪[n log n]         worst
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = 2n pairs + O(n / CUTOFF) tasks + p deques
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    const size_t team_size = parallelTeamSize(
+        length,
+        parallelThreadCount(nthreads),
+        PARALLEL_MIN_CHUNK_LENGTH
+    );
+
+    ParallelIntroCtx ctx;
+    ctx.array          = array;
+    ctx.key            = key;
+    ctx.length         = length;
+    ctx.range_capacity = 2u * team_size + 2u;
+    ctx.range_count    = 1;
+    ctx.items          = (KeyedItem *)malloc(length * sizeof(KeyedItem));
+    ctx.scratch        = (KeyedItem *)malloc(length * sizeof(KeyedItem));
+    ctx.counts         = (ParallelPartitionCounts *)malloc(team_size * sizeof(ParallelPartitionCounts));
+    ctx.ranges[0]      = (RangeTask *)malloc(ctx.range_capacity * sizeof(RangeTask));
+    ctx.ranges[1]      = (RangeTask *)malloc(ctx.range_capacity * sizeof(RangeTask));
+
+    if (ctx.items && ctx.scratch && ctx.counts && ctx.ranges[0] && ctx.ranges[1]) {
+        ctx.ranges[0][0] = (RangeTask){ 0, length, keyedIntroDepthLimit(length) };
+
+        parallelRun(team_size, parallelIntroTopWorker, &ctx);
+
+        taskPoolRun(
+            team_size,
+            2u * (length / PARALLEL_INTRO_TASK_CUTOFF) + 64u,
+            parallelIntroTask,
+            &ctx,
+            ctx.ranges[0],
+            ctx.range_count
+        );
+
+        parallelRun(team_size, parallelIntroWriteBackWorker, &ctx);
+    }
+
+    free(ctx.ranges[1]);
+    free(ctx.ranges[0]);
+    free(ctx.counts);
+    free(ctx.scratch);
+    free(ctx.items);
+}
+
+Array *arrayParallelIntroSorted(const Array *array, const key_val_func key, const size_t nthreads) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayParallelIntroSort(sorted_array, key, nthreads);
+
+    return sorted_array;
+}
@@ -0,0 +1,239 @@
+/// Parallel Merge Sort O(n log n / p) | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../../include/bds/bds_config.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_parallel.h"
+
+#include <stdlib.h>
+
+/**
+ * 1. **Chunks**: split A into p equal chunks. Each worker caches the keys of
+ *    its chunk and merge sorts it locally (stable).
+ * 2. **Merge levels**: ⌈log2 p⌉ levels merge pairs of neighbouring runs.
+ *    Instead of one worker per pair (which leaves p − 1 workers idle at the
+ *    last level), the *output* of the level is split evenly among all p
+ *    workers and each one finds where its output slice starts in both input
+ *    runs with a **merge-path** binary search.
+ * 3. **Write back**: every worker stores its slice of pointers into A.
+ *
+ * Merge path: for output position d of merge(X, Y), find i such that the
+ * first d outputs are X[0, i) ++ Y[0, d − i). Ties go to X, so the merge
+ * (and the whole sort) stays stable.
+ *
+ *        Y →
+ *      X ┌──────────┐
+ *      ↓ │╲  ╲  ╲   │   each diagonal d crosses the merge path once;
+ *        │ ╲  ╲  ╲  │   equal-length diagonals ⇒ equal work per worker
+ *        │  ╲  ╲  ╲ │
+ *        └──────────┘
+ */
+
+typedef struct parallel_merge_ctx {
+    Array *array;
+    key_val_func key;
+
+    KeyedItem *items;
+    KeyedItem *scratch;
+    size_t length;
+} ParallelMergeCtx;
+
+/// ===============================================================
+/// Merge path
+/// ===============================================================
+
+/**
+ * Number of elements taken from `left` among the first `diag` outputs of
+ * the stable merge of `left` and `right`.
+ */
+static size_t mergePathSplit(
+    const KeyedItem *left,
+    const size_t left_len,
+    const KeyedItem *right,
+    const size_t right_len,
+    const size_t diag
+) {
+    size_t lo = diag > right_len ? diag - right_len : 0;
+    size_t hi = diag < left_len ? diag : left_len;
+
+    while (lo < hi) {
+        const size_t mid = lo + ((hi - lo) >> 1);
+
+        // left[mid] goes before right[diag − mid − 1] ⇒ more than mid come from left
+        if (left[mid].key <= right[diag - mid - 1].key) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+/**
+ * Writes outputs [diag_lo, diag_hi) of the stable merge of `left` and `right`.
+ */
+static void mergePathSegment(
+    const KeyedItem *left,
+    const size_t left_len,
+    const KeyedItem *right,
+    const size_t right_len,
+    const size_t diag_lo,
+    const size_t diag_hi,
+    KeyedItem *out
+) {
+    size_t left_idx  = mergePathSplit(left, left_len, right, right_len, diag_lo);
+    size_t right_idx = diag_lo - left_idx;
+
+    for (size_t write_idx = diag_lo; write_idx < diag_hi; write_idx++) {
+        if (right_idx >= right_len || (left_idx < left_len && left[left_idx].key <= right[right_idx].key)) {
+            out[write_idx] = left[left_idx++];
+        } else {
+            out[write_idx] = right[right_idx++];
+        }
+    }
+}
+
+/// ===============================================================
+/// Worker
+/// ===============================================================
+
+static void parallelMergeSortWorker(void *arg, const ParallelWorker *worker) {
+    ParallelMergeCtx *ctx = (ParallelMergeCtx *)arg;
+
+    const size_t length = ctx->length;
+    const size_t chunks = worker->count;
+
+    size_t slice_lo, slice_hi;
+    parallelSplit(length, worker, &slice_lo, &slice_hi);
+
+    // 1) Cache keys of this chunk and sort it locally
+    const Array chunk = { ctx->array->data + slice_lo, slice_hi - slice_lo };
+    keyCacheFill(ctx->items + slice_lo, &chunk, ctx->key);
+    keyedMergeSort(ctx->items + slice_lo, ctx->scratch + slice_lo, slice_hi - slice_lo);
+
+    parallelSync(worker);
+
+    // 2) Merge levels: runs of `width` chunks are merged pairwise
+    KeyedItem *src = ctx->items;
+    KeyedItem *dst = ctx->scratch;
+
+    for (size_t width = 1; width < chunks; width <<= 1) {
+        for (size_t first = 0; first < chunks; first += width << 1) {
+            const size_t mid_chunk = first + width < chunks ? first + width : chunks;
+            const size_t end_chunk = first + (width << 1) < chunks ? first + (width << 1) : chunks;
+
+            const size_t run_lo  = parallelSplitAt(length, chunks, first);
+            const size_t run_mid = parallelSplitAt(length, chunks, mid_chunk);
+            const size_t run_hi  = parallelSplitAt(length, chunks, end_chunk);
+
+            // Part of this pair's output that falls in my slice
+            const size_t out_lo = run_lo > slice_lo ? run_lo : slice_lo;
+            const size_t out_hi = run_hi < slice_hi ? run_hi : slice_hi;
+            if (out_lo >= out_hi) continue;
+
+            mergePathSegment(
+                src + run_lo, run_mid - run_lo,
+                src + run_mid, run_hi - run_mid,
+                out_lo - run_lo, out_hi - run_lo,
+                dst + run_lo
+            );
+        }
+
+        KeyedItem *swap_tmp = src;
+        src = dst;
+        dst = swap_tmp;
+
+        parallelSync(worker);
+    }
+
+    // 3) Undecorate my slice
+    for (size_t i = slice_lo; i < slice_hi; i++) {
+        ctx->array->data[i] = src[i].ptr;
+    }
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+void arrayParallelMergeSort(Array *array, const key_val_func key, const size_t nthreads) {
+    /*
+    PARALLEL-MERGE-SORT(A, key, p)
+        n ← length(A)
+        C ← new array of n pairs ; T ← new array of n pairs
+
+        parallel for w ← 0 to p − 1 do
+            [lo, hi) ← SLICE(n, p, w)
+            C[lo..hi) ← [(key(A[i]), A[i]) for i ∈ [lo, hi)]
+            MERGE-SORT(C[lo..hi))                       // stable
+            BARRIER
+
+            src ← C ; dst ← T
+            for width ← 1, 2, 4, ... while width < p do
+                for each pair (X, Y) of runs of `width` chunks do
+                    [s, e) ← [lo, hi) ∩ output range of (X, Y)
+                    i ← MERGE-PATH(X, Y, s) ; j ← s − i
+                    merge X[i..], Y[j..] into dst[s..e)  // ties → X
+                swap(src, dst)
+                BARRIER
+
+            A[lo..hi) ← src[lo..hi).ptr
+
+    MERGE-PATH(X, Y, d)
+        lo ← max(0, d − |Y|) ; hi ← min(d, |X|)
+        while lo < hi do
+            mid ← ⌊(lo + hi)/2⌋
+            if X[mid].key ≤ Y[d − mid − 1].key then lo ← mid + 1
+            else hi ← mid
+        return lo
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), p = workers.
+
+       Local sorts:   (n/p) log(n/p)
+       Merge levels:  ⌈log2 p⌉ · (n/p + log n)     (equal slices via merge path)
+
+         T(n, p) = (n/p) log(n/p) + (n/p) log p + log p · log n
+
+       𝒪[T(n, p)]
+        = 𝒪[(n log n) / p]
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = 2n pairs + p thread stacks
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    ParallelMergeCtx ctx;
+    ctx.array   = array;
+    ctx.key     = key;
+    ctx.length  = length;
+    ctx.items   = (KeyedItem *)malloc(length * sizeof(KeyedItem));
+    ctx.scratch = (KeyedItem *)malloc(length * sizeof(KeyedItem));
+
+    if (ctx.items && ctx.scratch) {
+        const size_t team_size = parallelTeamSize(
+            length,
+            parallelThreadCount(nthreads),
+            PARALLEL_MIN_CHUNK_LENGTH
+        );
+
+        parallelRun(team_size, parallelMergeSortWorker, &ctx);
+    }
+
+    free(ctx.scratch);
+    free(ctx.items);
+}
+
+Array *arrayParallelMergeSorted(const Array *array, const key_val_func key, const size_t nthreads) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayParallelMergeSort(sorted_array, key, nthreads);
+
+    return sorted_array;
+}
@@ -0,0 +1,504 @@
+/// Pattern-Defeating Quick Sort O(n log n) | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_sort_context.h"
+
+#include <stdbool.h>
+
+/**
+ * pdqsort (Orson Peters, 2021) = IntroSort + pattern detection.
+ *
+ * 1. **Pivot**: median of 3, or pseudo-median of 9 (ninther) for large ranges.
+ * 2. **Block partition** (BlockQuicksort, Edelkamp & Weiss): compare 64
+ *    elements from each end, recording the offsets of misplaced ones with
+ *    `offsets[n] = i; n += (key < pivot);` — no data-dependent branch — then
+ *    swap the recorded pairs.
+ * 3. **Already partitioned**: if the partition did not swap anything and the
+ *    split is balanced, try a *partial* insertion sort on both sides that
+ *    gives up after 8 moves. Sorted / nearly sorted input finishes in O(n).
+ * 4. **Equal keys**: if the pivot equals the element just left of the range
+ *    (the previous pivot), everything == pivot is moved left and skipped.
+ * 5. **Bad partitions**: an unbalanced split (< 1/8) swaps a few fixed
+ *    elements around to break patterns; after log2(n) of them the range is
+ *    heap sorted, so the worst case stays O(n log n).
+ *
+ * Runs on the key cache: key() is called exactly n times.
+ */
+
+#define PDQ_INSERTION_THRESHOLD     24
+#define PDQ_NINTHER_THRESHOLD       128
+#define PDQ_PARTIAL_INSERTION_LIMIT 8
+#define PDQ_BLOCK_SIZE              64
+
+/// ===============================================================
+/// Small helpers
+/// ===============================================================
+
+static inline void pdqSwap(KeyedItem *a, KeyedItem *b) {
+    BDS_STATS_ADD(swaps, 1);
+
+    const KeyedItem temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static inline void pdqSort2(KeyedItem *a, KeyedItem *b) {
+    if (KEYED_CMP(b->key < a->key)) pdqSwap(a, b);
+}
+
+static inline void pdqSort3(KeyedItem *a, KeyedItem *b, KeyedItem *c) {
+    pdqSort2(a, b);
+    pdqSort2(b, c);
+    pdqSort2(a, b);
+}
+
+static size_t pdqLog2(size_t n) {
+    size_t result = 0;
+
+    while (n > 1) {
+        n >>= 1;
+        result++;
+    }
+
+    return result;
+}
+
+/// ===============================================================
+/// Insertion sorts
+/// ===============================================================
+
+static void pdqInsertionSort(KeyedItem *begin, KeyedItem *end) {
+    if (begin == end) return;
+
+    for (KeyedItem *cur = begin + 1; cur != end; cur++) {
+        KeyedItem *sift   = cur;
+        KeyedItem *sift_1 = cur - 1;
+
+        if (KEYED_CMP(sift->key < sift_1->key)) {
+            const KeyedItem temp = *sift;
+
+            do {
+                BDS_STATS_ADD(writes, 1);
+                *sift-- = *sift_1;
+            } while (sift != begin && KEYED_CMP(temp.key < (--sift_1)->key));
+
+            *sift = temp;
+            BDS_STATS_ADD(writes, 1);
+        }
+    }
+}
+
+/**
+ * Insertion sort without the lower bound check: *(begin - 1) is a previous
+ * pivot, so it is <= every element of [begin, end) and stops the scan.
+ */
+static void pdqUnguardedInsertionSort(KeyedItem *begin, KeyedItem *end) {
+    if (begin == end) return;
+
+    for (KeyedItem *cur = begin + 1; cur != end; cur++) {
+        KeyedItem *sift   = cur;
+        KeyedItem *sift_1 = cur - 1;
+
+        if (KEYED_CMP(sift->key < sift_1->key)) {
+            const KeyedItem temp = *sift;
+
+            do {
+                BDS_STATS_ADD(writes, 1);
+                *sift-- = *sift_1;
+            } while (KEYED_CMP(temp.key < (--sift_1)->key));
+
+            *sift = temp;
+            BDS_STATS_ADD(writes, 1);
+        }
+    }
+}
+
+/**
+ * Insertion sort that gives up (returns false) after moving more than
+ * PDQ_PARTIAL_INSERTION_LIMIT elements.
+ */
+static bool pdqPartialInsertionSort(KeyedItem *begin, KeyedItem *end) {
+    if (begin == end) return true;
+
+    size_t moved = 0;
+
+    for (KeyedItem *cur = begin + 1; cur != end; cur++) {
+        KeyedItem *sift   = cur;
+        KeyedItem *sift_1 = cur - 1;
+
+        if (KEYED_CMP(sift->key < sift_1->key)) {
+            const KeyedItem temp = *sift;
+
+            do {
+                BDS_STATS_ADD(writes, 1);
+                *sift-- = *sift_1;
+            } while (sift != begin && KEYED_CMP(temp.key < (--sift_1)->key));
+
+            *sift = temp;
+            BDS_STATS_ADD(writes, 1);
+            moved += (size_t)(cur - sift);
+        }
+
+        if (moved > PDQ_PARTIAL_INSERTION_LIMIT) return false;
+    }
+
+    return true;
+}
+
+/// ===============================================================
+/// Partitions
+/// ===============================================================
+
+/**
+ * Swaps the misplaced elements recorded in the two offset blocks.
+ * With equally many on both sides a cyclic permutation replaces the swaps.
+ */
+static void pdqSwapOffsets(
+    KeyedItem *first,
+    KeyedItem *last,
+    const unsigned char *offsets_l,
+    const unsigned char *offsets_r,
+    const size_t num,
+    const bool use_swaps
+) {
+    if (use_swaps) {
+        for (size_t i = 0; i < num; i++) {
+            pdqSwap(first + offsets_l[i], last - offsets_r[i]);
+        }
+
+    } else if (num > 0) {
+        BDS_STATS_ADD(writes, 2 * num);  // A cycle through 2·num slots
+
+        KeyedItem *l = first + offsets_l[0];
+        KeyedItem *r = last - offsets_r[0];
+        const KeyedItem temp = *l;
+        *l = *r;
+
+        for (size_t i = 1; i < num; i++) {
+            l = first + offsets_l[i];
+            *r = *l;
+            r = last - offsets_r[i];
+            *l = *r;
+        }
+
+        *r = temp;
+    }
+}
+
+/**
+ * Partitions [begin, end) around *begin: [< pivot] pivot [>= pivot].
+ * Returns the pivot position; *already_partitioned is set when no element
+ * had to move.
+ */
+static KeyedItem *pdqPartitionRightBranchless(
+    KeyedItem *begin,
+    KeyedItem *end,
+    bool *already_partitioned
+) {
+    const KeyedItem pivot = *begin;
+    KeyedItem *first = begin;
+    KeyedItem *last  = end;
+
+    // Median-of-3 guarantees an element >= pivot exists
+    while (KEYED_CMP((++first)->key < pivot.key)) {}
+
+    // Guard the search only if nothing before *first stops it
+    if (first - 1 == begin) {
+        while (first < last && !KEYED_CMP((--last)->key < pivot.key)) {}
+    } else {
+        while (!KEYED_CMP((--last)->key < pivot.key)) {}
+    }
+
+    *already_partitioned = first >= last;
+
+    if (!*already_partitioned) {
+        pdqSwap(first, last);
+        first++;
+
+        unsigned char offsets_l[PDQ_BLOCK_SIZE];
+        unsigned char offsets_r[PDQ_BLOCK_SIZE];
+
+        KeyedItem *offsets_l_base = first;
+        KeyedItem *offsets_r_base = last;
+        size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (first < last) {
+            // How many unknown elements each side may scan this round
+            const size_t num_unknown = (size_t)(last - first);
+            const size_t left_split  = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            const size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+            const size_t left_scan  = left_split  < PDQ_BLOCK_SIZE ? left_split  : PDQ_BLOCK_SIZE;
+            const size_t right_scan = right_split < PDQ_BLOCK_SIZE ? right_split : PDQ_BLOCK_SIZE;
+
+            // Branchless: always store the offset, only advance on a misplaced element
+            for (size_t i = 0; i < left_scan; i++) {
+                offsets_l[num_l] = (unsigned char)i;
+                num_l += !KEYED_CMP(first->key < pivot.key);
+                first++;
+            }
+
+            for (size_t i = 0; i < right_scan; i++) {
+                offsets_r[num_r] = (unsigned char)(i + 1);
+                num_r += KEYED_CMP((--last)->key < pivot.key);
+            }
+
+            const size_t num = num_l < num_r ? num_l : num_r;
+            pdqSwapOffsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+
+            num_l   -= num;
+            num_r   -= num;
+            start_l += num;
+            start_r += num;
+
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // Leftovers from one side: swap them into the boundary
+        if (num_l) {
+            while (num_l--) pdqSwap(offsets_l_base + offsets_l[start_l + num_l], --last);
+            first = last;
+        }
+
+        if (num_r) {
+            while (num_r--) {
+                pdqSwap(offsets_r_base - offsets_r[start_r + num_r], first);
+                first++;
+            }
+            last = first;
+        }
+    }
+
+    KeyedItem *pivot_pos = first - 1;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    BDS_STATS_ADD(writes, 2);
+
+    return pivot_pos;
+}
+
+/**
+ * Partitions [begin, end) around *begin: [<= pivot] pivot [> pivot].
+ * Used when the pivot equals the previous pivot: the left side is all equal.
+ */
+static KeyedItem *pdqPartitionLeft(KeyedItem *begin, KeyedItem *end) {
+    const KeyedItem pivot = *begin;
+    KeyedItem *first = begin;
+    KeyedItem *last  = end;
+
+    while (KEYED_CMP(pivot.key < (--last)->key)) {}
+
+    if (last + 1 == end) {
+        while (first < last && !KEYED_CMP(pivot.key < (++first)->key)) {}
+    } else {
+        while (!KEYED_CMP(pivot.key < (++first)->key)) {}
+    }
+
+    while (first < last) {
+        pdqSwap(first, last);
+        while (KEYED_CMP(pivot.key < (--last)->key)) {}
+        while (!KEYED_CMP(pivot.key < (++first)->key)) {}
+    }
+
+    KeyedItem *pivot_pos = last;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    BDS_STATS_ADD(writes, 2);
+
+    return pivot_pos;
+}
+
+/// ===============================================================
+/// Main loop
+/// ===============================================================
+
+static void pdqSortLoop(KeyedItem *begin, KeyedItem *end, size_t bad_allowed, bool leftmost) {
+    while (1) {
+        const size_t size = (size_t)(end - begin);
+
+        if (size < PDQ_INSERTION_THRESHOLD) {
+            if (leftmost) pdqInsertionSort(begin, end);
+            else pdqUnguardedInsertionSort(begin, end);
+            return;
+        }
+
+        // Pivot → *begin: median of 3 or ninther
+        const size_t half = size / 2;
+
+        if (size > PDQ_NINTHER_THRESHOLD) {
+            pdqSort3(begin, begin + half, end - 1);
+            pdqSort3(begin + 1, begin + (half - 1), end - 2);
+            pdqSort3(begin + 2, begin + (half + 1), end - 3);
+            pdqSort3(begin + (half - 1), begin + half, begin + (half + 1));
+            pdqSwap(begin, begin + half);
+        } else {
+            pdqSort3(begin + half, begin, end - 1);
+        }
+
+        // Pivot equals the previous pivot: peel off the run of equal keys
+        if (!leftmost && !KEYED_CMP((begin - 1)->key < begin->key)) {
+            begin = pdqPartitionLeft(begin, end) + 1;
+            continue;
+        }
+
+        bool already_partitioned;
+        KeyedItem *pivot_pos = pdqPartitionRightBranchless(begin, end, &already_partitioned);
+
+        const size_t l_size = (size_t)(pivot_pos - begin);
+        const size_t r_size = (size_t)(end - (pivot_pos + 1));
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                keyedHeapSortRange(begin, 0, size);
+                return;
+            }
+
+            // Deterministic shuffle of a few elements to break patterns
+            if (l_size >= PDQ_INSERTION_THRESHOLD) {
+                pdqSwap(begin, begin + l_size / 4);
+                pdqSwap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+                if (l_size > PDQ_NINTHER_THRESHOLD) {
+                    pdqSwap(begin + 1, begin + (l_size / 4 + 1));
+                    pdqSwap(begin + 2, begin + (l_size / 4 + 2));
+                    pdqSwap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                    pdqSwap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                }
+            }
+
+            if (r_size >= PDQ_INSERTION_THRESHOLD) {
+                pdqSwap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                pdqSwap(end - 1, end - r_size / 4);
+
+                if (r_size > PDQ_NINTHER_THRESHOLD) {
+                    pdqSwap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                    pdqSwap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                    pdqSwap(end - 2, end - (1 + r_size / 4));
+                    pdqSwap(end - 3, end - (2 + r_size / 4));
+                }
+            }
+
+        } else if (already_partitioned &&
+                   pdqPartialInsertionSort(begin, pivot_pos) &&
+                   pdqPartialInsertionSort(pivot_pos + 1, end)) {
+            // Balanced, nothing moved, and both sides were (nearly) sorted
+            return;
+        }
+
+        // Recurse left, loop right
+        pdqSortLoop(begin, pivot_pos, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+void keyedPdqSort(KeyedItem *items, const size_t length) {
+    if (length < 2) return;
+
+    pdqSortLoop(items, items + length, pdqLog2(length), true);
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+void arrayPdqSort(Array *array, const key_val_func key) {
+    /*
+    PDQ-SORT(A, key)
+        C ← [(key(A[i]), A[i]) for i ← 0 to n − 1]
+        PDQ-LOOP(C, 0, n, bad ← ⌊log2 n⌋, leftmost ← true)
+        A[i] ← C[i].ptr for all i
+
+    PDQ-LOOP(C, lo, hi, bad, leftmost)
+        loop
+            size ← hi − lo
+            if size < 24 then
+                INSERTION-SORT(C, lo, hi) ; return
+
+            if size > 128 then C[lo] ↔ NINTHER(C, lo, hi)
+            else C[lo] ↔ MEDIAN3(C[mid], C[lo], C[hi − 1])
+
+            if not leftmost and C[lo − 1] = C[lo] then
+                lo ← PARTITION-LEFT(C, lo, hi) + 1      // skip == pivot block
+                continue
+
+            (p, no_swaps) ← BLOCK-PARTITION-RIGHT(C, lo, hi)
+
+            if min(p − lo, hi − p − 1) < size / 8 then
+                bad ← bad − 1
+                if bad = 0 then
+                    HEAP-SORT(C, lo, hi) ; return
+                swap a few fixed elements of each side  // breaks patterns
+            else if no_swaps and PARTIAL-INSERTION(C, lo, p)
+                             and PARTIAL-INSERTION(C, p + 1, hi) then
+                return                                   // was (nearly) sorted
+
+            PDQ-LOOP(C, lo, p, bad, leftmost)
+            lo ← p + 1 ; leftmost ← false
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A).
+
+       Average:                 Θ(n log n)
+       Sorted / reverse:        Θ(n)  (partition finds nothing to swap and the
+                                       partial insertion sorts succeed)
+       Organ-pipe / perturbed:  Θ(n log n), but pattern breaking keeps the
+                                splits balanced
+       k distinct keys:         O(n log k) (equal-pivot runs are skipped)
+       Worst:                   O(n log n) (heap sort after log2 n bad splits)
+
+       𝒪[T(n)]
+        = 𝒪[n log n]
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = n pairs + 2·64 offset bytes + log n stack
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayPdqSortCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayPdqSortCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayPdqSort(array, key);
+        return;
+    }
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    KeyedItem *items = sortContextKeyCache(ctx, array, key);
+    if (!items) {
+        arrayIntroSort(array, key);  // No room for the cache: in place, key() per comparison
+        return;
+    }
+
+    keyedPdqSort(items, length);
+    keyCacheWriteBack(array, items);
+}
+
+Array *arrayPdqSorted(const Array *array, const key_val_func key) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayPdqSort(sorted_array, key);
+
+    return sorted_array;
+}
@@ -2,6 +2,9 @@
 
 #include "../../../include/bds/array/bds_array_utils.h"
 #include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_sort_kernels.h"
+#include "../../internal/bds_sort_network.h"
+#include "../../internal/bds_tuning.h"  // QUICK_LEAF_THRESHOLD
 
 /**
  *1. Choose a pivot element from the array.
@@ -9,10 +12,11 @@
  *  b. or **median-of-three** (usually the best choice)
  *  c. or first/last element.
  *2. Move elements smaller than the pivot to its left,
- *   and elements larger than the pivot to its right.
+ *   elements larger than the pivot to its right,
+ *   and keep every element equal to the pivot in the middle.
  *3. Recursively apply the same process to the left and right sub-arrays.
  *
- * [  lower_than_pivot  ]  pivot  [  higher_than_pivot  ]
+ * [  lower_than_pivot  ]  [ == pivot ]  [  higher_than_pivot  ]
  */
 
 
@@ -25,62 +29,21 @@
 ///
 /// Uses:
 ///   - Median-of-three pivot selection to reduce bad pivots.
-///   - Lomuto-style partitioning on the range [lo, hi).
-///   - Insertion sort for very small partitions.
+///   - 3-way (Dutch national flag) partitioning on the range [lo, hi);
+///     keys equal to the pivot are excluded from recursion.
+///   - Sorting networks for very small partitions.
 ///
 /// Not stable. In-place. Average-case very fast.
 /// ===============================================================
 
-#define QUICK_INSERTION_THRESHOLD 16
-
 /// ---------------------------------------------------------------
-/// Insertion sort for small ranges [lo, hi)
+/// Partition (3-way, Dutch national flag) with median-of-three pivot
 /// ---------------------------------------------------------------
 
 /**
- * Insertion sort over [lo, hi).
- * Stable and efficient for tiny partitions.
+ * Orders (lo, mid, hi-1) by key and returns mid, which now holds their median.
  */
-static void quickInsertionSortRange(
-    Array *array,
-    const size_t lo,
-    const size_t hi,
-    const key_val_func key
-) {
-    if (hi - lo < 2) return;
-
-    for (size_t i = lo + 1; i < hi; i++) {
-        void  *pivot     = arrayGet(array, i);
-        size_t scan_idx  = i;
-
-        // Shift larger elements to the right
-        while (scan_idx > lo &&
-               arrayKeyCompare(arrayGet(array, scan_idx - 1), pivot, key) > 0) {
-
-            arraySet(array, scan_idx, arrayGet(array, scan_idx - 1));
-            scan_idx--;
-        }
-
-        arraySet(array, scan_idx, pivot);
-    }
-}
-
-/// ---------------------------------------------------------------
-/// Partition (Lomuto) with median-of-three pivot
-/// ---------------------------------------------------------------
-
-/**
- * Partitions the subarray [lo, hi) using a median-of-three pivot:
- *   - Choose pivot as median of (lo, mid, hi-1).
- *   - Move pivot to hi-1.
- *   - Partition elements so that:
- *       [lo, pivot_idx)   < pivot
- *       [pivot_idx]       == pivot
- *       (pivot_idx, hi)   >= pivot
- *
- * Returns: final pivot index in [lo, hi).
- */
-static size_t quickPartition(
+size_t sortKernelMedianOfThree(
     Array *array,
     const size_t lo,
     const size_t hi,
@@ -89,7 +52,6 @@ static size_t quickPartition(
     const size_t hi_1 = hi - 1;
     const size_t mid  = lo + ((hi - lo) >> 1);
 
-    // Median-of-three on (lo, mid, hi-1)
     if (arrayKeyCompare(arrayGet(array, mid), arrayGet(array, lo), key) < 0)
         arraySwap(array, lo, mid);
 
@@ -99,24 +61,54 @@ static size_t quickPartition(
     if (arrayKeyCompare(arrayGet(array, hi_1), arrayGet(array, mid), key) < 0)
         arraySwap(array, mid, hi_1);
 
-    // Use mid as pivot; move it to hi-1 for Lomuto partitioning
-    arraySwap(array, mid, hi_1);
-    const void *pivot = arrayGet(array, hi_1);
-
-    size_t store_idx = lo;
+    return mid;
+}
 
-    // Lomuto partition: scan [lo, hi-1)
-    for (size_t i = lo; i < hi_1; i++) {
-        if (arrayKeyCompare(arrayGet(array, i), pivot, key) < 0) {
-            arraySwap(array, i, store_idx);
-            store_idx++;
+/**
+ * Partitions the subarray [lo, hi) around the key of array[pivot_idx] into
+ *       [lo, *eq_lo)      < pivot
+ *       [*eq_lo, *eq_hi)  == pivot
+ *       [*eq_hi, hi)      > pivot
+ *
+ * Elements equal to the pivot are already in place and are never
+ * recursed into, so runs of duplicate keys cost a single scan.
+ * The pivot key is read once, so the scan makes one key() call per element.
+ */
+void sortKernelPartitionAround(
+    Array *array,
+    const size_t lo,
+    const size_t hi,
+    const size_t pivot_idx,
+    const key_val_func key,
+    size_t *eq_lo,
+    size_t *eq_hi
+) {
+    const int pivot_key = key(arrayGet(array, pivot_idx));
+
+    size_t less_end   = lo;  // [lo, less_end)       < pivot
+    size_t scan_idx   = lo;  // [less_end, scan_idx) == pivot
+    size_t more_start = hi;  // [more_start, hi)     > pivot
+
+    while (scan_idx < more_start) {
+        const int scan_key = key(arrayGet(array, scan_idx));
+
+        if (scan_key < pivot_key) {
+            arraySwap(array, less_end, scan_idx);
+            less_end++;
+            scan_idx++;
+        } else if (scan_key > pivot_key) {
+            more_start--;
+            arraySwap(array, scan_idx, more_start);
+        } else {
+            scan_idx++;
         }
     }
 
-    // Place pivot in its final position
-    arraySwap(array, store_idx, hi_1);
+    BDS_STATS_ADD(key_calls, 1 + (hi - lo));  // pivot + one per scanned element
+    BDS_STATS_ADD(compares, hi - lo);         // one three-way compare per scanned element
 
-    return store_idx;
+    *eq_lo = less_end;
+    *eq_hi = more_start;
 }
 
 /// ---------------------------------------------------------------
@@ -125,7 +117,7 @@ static size_t quickPartition(
 
 /**
  * Recursive QuickSort engine on [lo, hi).
- * Uses insertion sort for small ranges to reduce overhead.
+ * Uses a sorting network for small ranges to reduce overhead.
  */
 static void quickSortRecursive(
     Array *array,
@@ -136,21 +128,23 @@ static void quickSortRecursive(
     // Base case: empty or single element
     if (hi - lo < 2) return;
 
-    // For small ranges, use insertion sort
-    if (hi - lo <= QUICK_INSERTION_THRESHOLD) {
-        quickInsertionSortRange(array, lo, hi, key);
+    // For small ranges, use a sorting network
+    if (hi - lo <= QUICK_LEAF_THRESHOLD) {
+        sortNetworkSortRange(array, lo, hi, key);
         return;
     }
 
-    // Partition around pivot
-    const size_t pivot_idx = quickPartition(array, lo, hi, key);
+    // Partition around a median-of-three pivot
+    size_t eq_lo, eq_hi;
+    const size_t pivot_idx = sortKernelMedianOfThree(array, lo, hi, key);
+    sortKernelPartitionAround(array, lo, hi, pivot_idx, key, &eq_lo, &eq_hi);
 
-    // Recursively sort partitions (excluding pivot)
-    if (pivot_idx > lo)
-        quickSortRecursive(array, lo, pivot_idx, key);
+    // Recursively sort partitions (excluding the == pivot block)
+    if (eq_lo > lo)
+        quickSortRecursive(array, lo, eq_lo, key);
 
-    if (pivot_idx + 1 < hi)
-        quickSortRecursive(array, pivot_idx + 1, hi, key);
+    if (eq_hi < hi)
+        quickSortRecursive(array, eq_hi, hi, key);
 }
 
 /// ---------------------------------------------------------------
@@ -171,31 +165,27 @@ void arrayQuickSort(
     if hi − lo < 2 then
         return
 
-    if hi − lo ≤ QUICK_INSERTION_THRESHOLD then
-        INSERTION-SORT-RANGE(A, lo, hi, key)
+    if hi − lo ≤ QUICK_LEAF_THRESHOLD then
+        NETWORK-SORT-RANGE(A, lo, hi, key)
         return
 
-    p ← PARTITION-MEDIAN3-LOMUTO(A, lo, hi, key)
-
-    if p > lo then
-        QUICK-SORT-REC(A, lo, p, key)         // left partition [lo, p)
+    (lt, gt) ← PARTITION-MEDIAN3-3WAY(A, lo, hi, key)
 
-    if p + 1 < hi then
-        QUICK-SORT-REC(A, p + 1, hi, key)     // right partition (p, hi)
+    if lt > lo then
+        QUICK-SORT-REC(A, lo, lt, key)        // left partition [lo, lt)
 
-    INSERTION-SORT-RANGE(A, lo, hi, key)
-    // stable insertion sort over A[lo..hi)
-    for i ← lo + 1 to hi − 1 do
-        x ← A[i]
-        j ← i
+    if gt < hi then
+        QUICK-SORT-REC(A, gt, hi, key)        // right partition [gt, hi)
 
-        while j > lo and key(A[j − 1]) > key(x) do
-            A[j] ← A[j − 1]
-            j ← j − 1
+    NETWORK-SORT-RANGE(A, lo, hi, key)
+    // leaf kernel, hi − lo ≤ 16: one key() call per element, no branches
+    for i ← 0 to hi − lo − 1 do
+        r[i] ← (key(A[lo + i]), i)          // unique rank ⇒ stable
+    apply the fixed comparator network for size hi − lo to r
+        // each step: r[a], r[b] ← min(r[a], r[b]), max(r[a], r[b])
+    A[lo..hi) ← [A[lo + r[i].i] for i ← 0 to hi − lo − 1]
 
-        A[j] ← x
-
-    PARTITION-MEDIAN3-LOMUTO(A, lo, hi, key)
+    PARTITION-MEDIAN3-3WAY(A, lo, hi, key)
     // choose pivot by median-of-three: (lo, mid, hi-1)
     mid ← lo + ⌊(hi − lo)/2⌋
     last ← hi − 1
@@ -204,19 +194,22 @@ void arrayQuickSort(
     if key(A[last]) < key(A[lo]) then swap(A[lo], A[last])
     if key(A[last]) < key(A[mid]) then swap(A[mid], A[last])
 
-    // move chosen pivot to end (last) and run Lomuto on [lo, last)
-    swap(A[mid], A[last])
-    pivot ← A[last]
+    pivot ← key(A[mid])                    // read once
 
-    store ← lo
+    // Dutch national flag: [lo, lt) < pivot, [lt, i) = pivot, [gt, hi) > pivot
+    lt ← lo ; i ← lo ; gt ← hi
 
-    for i ← lo to last − 1 do
-        if key(A[i]) < key(pivot) then
-            swap(A[i], A[store])
-            store ← store + 1
+    while i < gt do
+        if key(A[i]) < pivot then
+            swap(A[lt], A[i])
+            lt ← lt + 1 ; i ← i + 1
+        else if key(A[i]) > pivot then
+            gt ← gt − 1
+            swap(A[i], A[gt])
+        else
+            i ← i + 1
 
-    swap(A[store], A[last])
-    return store
+    return (lt, gt)
     */
 
     /* Time Complexity Analysis:
@@ -239,9 +232,16 @@ void arrayQuickSort(
 
          𝒪[T(n)] = 𝒪[n²]
 
-       Note on the insertion-sort threshold:
-         For partitions of size ≤ 16, the algorithm switches to insertion sort.
-         This improves constants but does not change the asymptotic bounds.
+       Duplicate keys (k distinct values):
+         Every partition removes all copies of its pivot value, so the
+         recursion only ever splits between distinct keys. With good pivots
+         the depth is Θ(log k) and each level scans at most n elements:
+           T(n) = Θ(n log k)      (all keys equal ⇒ one Θ(n) scan)
+
+       Note on the leaf threshold:
+         For partitions of size ≤ 16, the algorithm switches to a sorting network
+         (a fixed, branchless sequence of compare-exchanges, one key() call per
+         element). This improves constants but does not change the asymptotic bounds.
     */
 
     /* Additional Memory Analysis:
@@ -0,0 +1,185 @@
+/// Radix Sort (LSD) O(n) | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_sort_context.h"
+
+#include <stdint.h>
+
+/**
+ * Non-comparison sort on the int returned by key_val_func.
+ *
+ * 1. **Decorate**: cache (key, ptr) pairs, key() called once per element.
+ * 2. **Bias**: flip the sign bit so negative keys order before positive ones
+ *    when read as unsigned: -2³¹ → 0x00000000, -1 → 0x7FFFFFFF, 0 → 0x80000000.
+ * 3. **Count**: one scan builds the histograms of all 4 byte-digits at once.
+ * 4. **Scatter**: for each digit, least significant first, prefix-sum its
+ *    histogram and scatter into the other buffer (stable, so the previous
+ *    digits' order is kept). Digits where every key falls in one bucket are
+ *    skipped entirely.
+ * 5. **Undecorate**: the last pass scatters the payloads straight back into
+ *    the Array instead of into the other buffer.
+ */
+
+#define RADIX_BITS    8
+#define RADIX_BUCKETS (1u << RADIX_BITS)
+#define RADIX_MASK    (RADIX_BUCKETS - 1u)
+#define RADIX_PASSES  (32 / RADIX_BITS)
+
+static inline uint32_t radixBiasedKey(const int key) {
+    return (uint32_t)key ^ 0x80000000u;
+}
+
+static inline size_t radixDigit(const int key, const unsigned pass) {
+    return (radixBiasedKey(key) >> (pass * RADIX_BITS)) & RADIX_MASK;
+}
+
+/**
+ * Stable LSD radix sort of `items` using `scratch` (same length) as the
+ * ping-pong buffer. The last executed pass scatters only the payloads,
+ * straight into `out`, which saves the separate write-back pass.
+ */
+void keyedRadixSort(KeyedItem *items, KeyedItem *scratch, const size_t length, void **out) {
+    if (length == 0) return;
+
+    size_t histogram[RADIX_PASSES][RADIX_BUCKETS] = {{0}};
+
+    for (size_t i = 0; i < length; i++) {
+        for (unsigned pass = 0; pass < RADIX_PASSES; pass++) {
+            histogram[pass][radixDigit(items[i].key, pass)]++;
+        }
+    }
+
+    // All keys share a digit: that pass would be the identity
+    unsigned passes[RADIX_PASSES];
+    unsigned pass_count = 0;
+
+    for (unsigned pass = 0; pass < RADIX_PASSES; pass++) {
+        if (histogram[pass][radixDigit(items[0].key, pass)] != length) passes[pass_count++] = pass;
+    }
+
+    KeyedItem *src = items;
+    KeyedItem *dst = scratch;
+
+    BDS_STATS_ADD(writes, (pass_count > 0 ? pass_count : 1) * length);  // No compares: one store per item and pass
+
+    for (unsigned executed = 0; executed < pass_count; executed++) {
+        const unsigned pass = passes[executed];
+        size_t *counts = histogram[pass];
+
+        // Exclusive prefix sum ⇒ first output slot for each bucket
+        size_t offset = 0;
+        for (size_t bucket = 0; bucket < RADIX_BUCKETS; bucket++) {
+            const size_t count = counts[bucket];
+            counts[bucket] = offset;
+            offset += count;
+        }
+
+        if (executed + 1 == pass_count) {
+            for (size_t i = 0; i < length; i++) {
+                out[counts[radixDigit(src[i].key, pass)]++] = src[i].ptr;
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < length; i++) {
+            dst[counts[radixDigit(src[i].key, pass)]++] = src[i];
+        }
+
+        KeyedItem *swap_tmp = src;
+        src = dst;
+        dst = swap_tmp;
+    }
+
+    // Every key is equal: already in order
+    for (size_t i = 0; i < length; i++) {
+        out[i] = items[i].ptr;
+    }
+}
+
+void arrayRadixSort(Array *array, const key_val_func key) {
+    /*
+    RADIX-SORT(A, key)
+        n ← length(A)
+        if n < 2 then
+            return
+
+        C ← [(key(A[i]) XOR 0x80000000, A[i]) for i ← 0 to n − 1]
+        T ← new array of n pairs
+
+        H[0..3][0..255] ← 0
+        for each c in C do
+            for d ← 0 to 3 do
+                H[d][DIGIT(c.key, d)] ← H[d][DIGIT(c.key, d)] + 1
+
+        D ← [d ∈ 0..3 : H[d][DIGIT(C[0].key, d)] ≠ n]  // single bucket: skip pass
+        if D = ∅ then
+            A[i] ← C[i].ptr for all i ; return
+
+        for each d in D do
+            H[d] ← EXCLUSIVE-PREFIX-SUM(H[d])
+            for each c in C (in order) do
+                if d is the last of D then
+                    A[H[d][DIGIT(c.key, d)]] ← c.ptr   // last pass: payloads only
+                else
+                    T[H[d][DIGIT(c.key, d)]] ← c
+                H[d][DIGIT(c.key, d)] ← H[d][DIGIT(c.key, d)] + 1
+            swap(C, T)
+
+    DIGIT(k, d)
+        return (k >> (8·d)) AND 0xFF
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A), w = 32 key bits, r = 8 bits per digit.
+
+         T(n) = n (key calls + histograms) + (w / r)·(n + 2^r)
+              = n + 4·(n + 256)
+
+       𝒪[T(n)]
+        = 𝒪[n]
+
+       Independent of input order (best = average = worst).
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = 2n pairs + 4·256 counters
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayRadixSortCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayRadixSortCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayRadixSort(array, key);
+        return;
+    }
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    // No room for the cache: the Array-level TimSort is stable too (key() per comparison)
+    KeyedItem *scratch = sortContextScratch(ctx, length);
+    KeyedItem *items = scratch ? sortContextKeyCache(ctx, array, key) : NULL;
+    if (!items) {
+        arrayTimSort(array, key);
+        return;
+    }
+
+    keyedRadixSort(items, scratch, length, array->data);
+}
+
+Array *arrayRadixSorted(const Array *array, const key_val_func key) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arrayRadixSort(sorted_array, key);
+
+    return sorted_array;
+}
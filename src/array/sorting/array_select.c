@@ -0,0 +1,336 @@
+/// Selection and Top-k O(n) on average | ARR
+
+#include "../../../include/bds/array/bds_array_utils.h"
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_sort_kernels.h"
+#include "../../internal/bds_sort_network.h"
+
+/**
+ * Answers "which elements are the k smallest?" without sorting everything.
+ *
+ * 1. **Select** (introselect + Floyd-Rivest): partition like QuickSort, but
+ *    only continue into the side that holds rank k. Large ranges first
+ *    select k inside a small window around k — a sample of ~n^(2/3)
+ *    elements — so the pivot lands within a few elements of rank k and the
+ *    range shrinks to a sliver after one partition.
+ * 2. **Heap pass**: for k ≪ n, a max-heap of the k best so far is kept at
+ *    the front; every other element costs a single key comparison against
+ *    the heap top, and only improvements touch the heap.
+ * 3. **Safety**: after 2·log2(n) bad partitions the range is finished by
+ *    the heap pass, so the worst case is O(n log n).
+ */
+
+#define SELECT_LEAF_THRESHOLD   16   // ranges up to this size go to a sorting network
+#define SELECT_SAMPLE_THRESHOLD 600  // larger ranges pick their pivot by Floyd-Rivest sampling
+#define SELECT_HEAP_RATIO       256  // k ≤ n / ratio → heap pass instead of select + sort
+
+/// ===============================================================
+/// Small helpers
+/// ===============================================================
+
+static size_t selectLog2Size(size_t n) {
+    size_t result = 0;
+
+    while (n > 1) {
+        n >>= 1;
+        result++;
+    }
+
+    return result;
+}
+
+// Largest r with r^degree ≤ n, for degree 2 or 3 (bit by bit, no libm)
+static size_t selectIntRoot(const size_t n, const unsigned int degree) {
+    size_t root = 0;
+
+    for (size_t bit = (size_t)1 << 31; bit > 0; bit >>= 1) {
+        const size_t candidate = root | bit;
+        const size_t bound = degree == 2 ? n / candidate : n / candidate / candidate;
+
+        if (candidate <= bound) root = candidate;
+    }
+
+    return root;
+}
+
+/// ===============================================================
+/// Heap pass
+/// ===============================================================
+
+/**
+ * Leaves the heap_hi − lo smallest elements of [lo, hi) in [lo, heap_hi),
+ * arranged as a max-heap. Needs lo < heap_hi ≤ hi.
+ */
+static void selectHeapPrefix(
+    Array *array,
+    const size_t lo,
+    const size_t heap_hi,
+    const size_t hi,
+    const key_val_func key
+) {
+    for (size_t i = lo + ((heap_hi - lo) >> 1); i-- > lo; ) {
+        sortKernelHeapSiftDown(array, i, lo, heap_hi, key);
+    }
+
+    int top_key = key(arrayGet(array, lo));
+
+    for (size_t i = heap_hi; i < hi; i++) {
+        if (key(arrayGet(array, i)) >= top_key) continue;
+
+        arraySwap(array, lo, i);
+        sortKernelHeapSiftDown(array, lo, lo, heap_hi, key);
+        top_key = key(arrayGet(array, lo));
+    }
+}
+
+/// ===============================================================
+/// Introselect with Floyd-Rivest pivots
+/// ===============================================================
+
+/**
+ * Rearranges [lo, hi) so that array[k] holds the element of rank k − lo,
+ * everything before it has a key ≤ and everything after a key ≥.
+ */
+static void selectRange(
+    Array *array,
+    size_t lo,
+    size_t hi,
+    const size_t k,
+    size_t depth_limit,
+    const key_val_func key
+) {
+    while (hi - lo > SELECT_LEAF_THRESHOLD) {
+        if (depth_limit == 0) {
+            selectHeapPrefix(array, lo, k + 1, hi, key);
+            arraySwap(array, lo, k);
+            return;
+        }
+
+        depth_limit--;
+
+        const size_t length = hi - lo;
+        size_t pivot_idx;
+
+        if (length > SELECT_SAMPLE_THRESHOLD) {
+            // Floyd-Rivest: sample size s ≈ n^(2/3) / 2, window skewed by
+            // sd ≈ sqrt(s · ln n) / 2 towards the middle so that rank k is
+            // very likely inside [new_lo, new_hi) after the recursive select
+            const size_t offset  = k - lo;
+            const size_t cbrt_n  = selectIntRoot(length, 3);
+            const size_t sample  = (cbrt_n * cbrt_n) >> 1;
+            const size_t ln_n    = (selectLog2Size(length) * 11u) >> 4;  // ≈ log2 n · ln 2
+            const size_t deviate = selectIntRoot(ln_n * sample, 2) >> 1;
+
+            size_t reach_lo = (size_t)((double)offset * (double)sample / (double)length);
+            size_t reach_hi = (size_t)((double)(length - offset) * (double)sample / (double)length);
+
+            if (offset < (length >> 1)) {
+                reach_lo += deviate;
+                reach_hi = reach_hi > deviate ? reach_hi - deviate : 0;
+            } else {
+                reach_lo = reach_lo > deviate ? reach_lo - deviate : 0;
+                reach_hi += deviate;
+            }
+
+            const size_t new_lo = offset > reach_lo ? k - reach_lo : lo;
+            const size_t new_hi = hi - k - 1 > reach_hi ? k + reach_hi + 1 : hi;
+
+            selectRange(array, new_lo, new_hi, k, depth_limit, key);
+            pivot_idx = k;
+        } else {
+            pivot_idx = sortKernelMedianOfThree(array, lo, hi, key);
+        }
+
+        size_t eq_lo, eq_hi;
+        sortKernelPartitionAround(array, lo, hi, pivot_idx, key, &eq_lo, &eq_hi);
+
+        if (k < eq_lo) {
+            hi = eq_lo;
+        } else if (k >= eq_hi) {
+            lo = eq_hi;
+        } else {
+            return;  // k sits in the == pivot block
+        }
+    }
+
+    sortNetworkSortRange(array, lo, hi, key);
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+void *arraySelectKth(Array *array, const size_t k, const key_val_func key) {
+    /*
+    SELECT-KTH(A, k, key)
+        if k ≥ n then
+            return NIL
+        SELECT-RANGE(A, 0, n, k, depth ← 2·⌊log2 n⌋)
+        return A[k]
+
+    SELECT-RANGE(A, lo, hi, k, depth)
+        while hi − lo > SELECT_LEAF_THRESHOLD do
+            if depth = 0 then
+                HEAP-PREFIX(A, lo, k + 1, hi) ; swap(A[lo], A[k])   // max of the k+1 smallest
+                return
+            depth ← depth − 1
+
+            if hi − lo > SELECT_SAMPLE_THRESHOLD then
+                // Floyd-Rivest: s ≈ n^(2/3)/2, window of ~s elements around k
+                (lo', hi') ← window around k, proportional to (k − lo, hi − k), skewed by ±√(s ln n)/2
+                SELECT-RANGE(A, lo', hi', k, depth)
+                p ← k
+            else
+                p ← MEDIAN3(A, lo, hi)
+
+            (lt, gt) ← PARTITION-AROUND(A, lo, hi, p)    // 3-way, A[lt..gt) = pivot
+            if k < lt then hi ← lt
+            else if k ≥ gt then lo ← gt
+            else return
+
+        NETWORK-SORT-RANGE(A, lo, hi)
+
+    HEAP-PREFIX(A, lo, m, hi)
+        BUILD-MAX-HEAP(A, lo, m)
+        for i ← m to hi − 1 do
+            if key(A[i]) < key(A[lo]) then          // key(A[lo]) is kept in a local
+                swap(A[lo], A[i]) ; HEAP-SIFT-DOWN(A, lo, lo, m)
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A).
+
+       Average:
+         Each partition keeps only the side holding k. With Floyd-Rivest
+         sampling the first partition already leaves O(n^(2/3)) elements, so
+           T(n) = n + min(k, n − k) + o(n) comparisons  = Θ(n)
+
+       Worst:
+         Depth limit 2·log2 n, then one heap pass over the rest:
+           T(n) = O(n log n)
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = O(log n) stack (the sample recursion nests at most log log n
+       deep; the partition loop is iterative)
+    */
+
+    const size_t length = arrayLength(array);
+    if (k >= length) return NULL;
+
+    selectRange(array, 0, length, k, sortKernelIntroDepthLimit(length), key);
+
+    return arrayGet(array, k);
+}
+
+void arrayPartialSort(Array *array, size_t k, const key_val_func key) {
+    /*
+    PARTIAL-SORT(A, k, key)
+        k ← min(k, n)
+        if k ≤ n / SELECT_HEAP_RATIO then
+            HEAP-PREFIX(A, 0, k, n)                  // one pass, O(n log k)
+            HEAP-SORT-RANGE(A, 0, k)
+        else
+            SELECT-RANGE(A, 0, n, k − 1)             // A[k − 1] in place, A[0..k−1) ≤ it
+            INTRO-SORT-RANGE(A, 0, k − 1)
+    */
+
+    /* Time Complexity Analysis:
+       Small k (heap pass): every element costs one comparison against the
+       heap top; on random input only O(k log(n/k)) of them enter the heap.
+         T(n, k) = n + O(k log k log(n/k)) average, O(n log k) worst
+
+       Larger k: T(n, k) = Θ(n) + Θ(k log k)
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = O(log n) stack
+    */
+
+    const size_t length = arrayLength(array);
+    if (k > length) k = length;
+    if (k == 0 || length < 2) return;
+
+    if (k <= length / SELECT_HEAP_RATIO) {
+        selectHeapPrefix(array, 0, k, length, key);
+        sortKernelHeapSortRange(array, 0, k, key);
+        return;
+    }
+
+    if (k < length) {
+        selectRange(array, 0, length, k - 1, sortKernelIntroDepthLimit(length), key);
+        sortKernelIntroSortRange(array, 0, k - 1, key);
+    } else {
+        sortKernelIntroSortRange(array, 0, length, key);
+    }
+}
+
+Array *arrayTopK(const Array *array, size_t k, const key_val_func key) {
+    /*
+    TOP-K(A, k, key)
+        k ← min(k, n)
+        if k ≤ n / SELECT_HEAP_RATIO then
+            R ← A[0..k)                              // only k pointers copied
+            BUILD-MAX-HEAP(R)
+            for i ← k to n − 1 do
+                if key(A[i]) < key(R[0]) then R[0] ← A[i] ; HEAP-SIFT-DOWN(R, 0)
+            HEAP-SORT(R)
+        else
+            C ← copy(A) ; PARTIAL-SORT(C, k) ; R ← C[0..k)
+        return R
+    */
+
+    /* Time Complexity Analysis:
+       Same as PARTIAL-SORT; the input is never modified.
+    */
+
+    /* Additional Memory Analysis:
+       m(n) = k pointers for small k, n pointers (temporary copy) otherwise
+    */
+
+    const size_t length = arrayLength(array);
+    if (k > length) k = length;
+
+    Array *top = arrayNew(k);
+    if (!top) return NULL;
+    if (k == 0) return top;
+
+    if (k <= length / SELECT_HEAP_RATIO) {
+        for (size_t i = 0; i < k; i++) {
+            arraySet(top, i, arrayGet(array, i));
+        }
+
+        for (size_t i = k >> 1; i-- > 0; ) {
+            sortKernelHeapSiftDown(top, i, 0, k, key);
+        }
+
+        int top_key = key(arrayGet(top, 0));
+
+        for (size_t i = k; i < length; i++) {
+            void *datapoint = arrayGet(array, i);
+            if (key(datapoint) >= top_key) continue;
+
+            arraySet(top, 0, datapoint);
+            sortKernelHeapSiftDown(top, 0, 0, k, key);
+            top_key = key(arrayGet(top, 0));
+        }
+
+        sortKernelHeapSortRange(top, 0, k, key);
+        return top;
+    }
+
+    Array *copy = arrayShallowCopy(array);
+    if (!copy) {
+        arrayFree(top);
+        return NULL;
+    }
+
+    arrayPartialSort(copy, k, key);
+
+    for (size_t i = 0; i < k; i++) {
+        arraySet(top, i, arrayGet(copy, i));
+    }
+
+    arrayFree(copy);
+    return top;
+}
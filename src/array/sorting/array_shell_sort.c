@@ -1,9 +1,12 @@
 /// Shell Sort O(n log² n) | ARR
 
 #include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_tuning.h"  // SHELL_GAP_SEQUENCE
+
+#include <stdint.h>  // SIZE_MAX
 
 // ===============================================================
-// Shell Sort (Hibbard gaps: 1, 3, 7, 15...)
+// Shell Sort (Hibbard gaps by default: 1, 3, 7, 15...)
 // ===============================================================
 //
 // Shell Sort improves Insertion Sort by allowing comparisons of
@@ -23,16 +26,36 @@
 // ===============================================================
 
 // ---------------------------------------------------------------
-// Hibbard gap calculation: largest 2^k - 1 <= length
+// Gap sequence (SHELL_GAP_SEQUENCE, picked by `make tune`)
 // ---------------------------------------------------------------
-static size_t shellInitialGap(const size_t length) {
+#define SHELL_MAX_GAPS 64  // Hibbard, the slowest-growing, needs < 64 gaps
+
+static const size_t shell_ciura_gaps[] = { 1, 4, 10, 23, 57, 132, 301, 701 };
+
+static size_t shellNextGap(const size_t gap, const size_t count) {
+    switch (SHELL_GAP_SEQUENCE) {
+        case SHELL_GAPS_KNUTH:
+            return 3 * gap + 1;  // 1, 4, 13, 40, ...
+        case SHELL_GAPS_CIURA:
+            if (count < sizeof(shell_ciura_gaps) / sizeof(shell_ciura_gaps[0])) return shell_ciura_gaps[count];
+            return gap * 9 / 4;  // Past the measured table: ×2.25
+        default:
+            return (gap << 1) + 1;  // 1, 3, 7, 15, 31, ...
+    }
+}
+
+// Fills gaps[] with the sequence's gaps below length, ascending; returns how many
+static size_t shellGaps(const size_t length, size_t gaps[SHELL_MAX_GAPS]) {
+    size_t count = 0;
     size_t gap = 1;
 
-    while ((gap << 1) + 1 < length) {
-        gap = (gap << 1) + 1;   // 1, 3, 7, 15, 31, ...
+    while (gap < length && count < SHELL_MAX_GAPS) {
+        gaps[count++] = gap;
+        if (gap > SIZE_MAX / 9) break;  // Keeps 3·gap + 1 and 9·gap from overflowing
+        gap = shellNextGap(gap, count);
     }
 
-    return gap;
+    return count;
 }
 
 // ---------------------------------------------------------------
@@ -50,7 +73,8 @@ static void shellGappedInsertionSort(
 
         // Standard insertion sort, but stepping by 'gap'
         while (j >= gap &&
-               key(arrayGet(array, j - gap)) > key(value)) {
+               (BDS_STATS_ADD(key_calls, 2), BDS_STATS_ADD(compares, 1),
+                key(arrayGet(array, j - gap)) > key(value))) {
 
             arraySet(array, j, arrayGet(array, j - gap));
             j -= gap;
@@ -73,13 +97,11 @@ void arrayShellSort(
         if n < 2 then
             return
 
-        // Compute initial gap using Hibbard sequence: 2^k − 1
-        gap ← 1
-        while (2·gap + 1) < n do
-            gap ← 2·gap + 1
+        // Gap sequence below n (Hibbard by default: 1, 3, 7, ..., 2^k − 1)
+        G ← [g₀ = 1, g₁, ..., g_m] with every g_i < n
 
-        // Decrease gap and perform gapped insertion sort
-        while gap > 0 do
+        // Largest gap first, gapped insertion sort per gap
+        for gap ← g_m down to g₀ do
             for i ← gap to n − 1 do
                 temp ← A[i]
                 j ← i
@@ -89,8 +111,6 @@ void arrayShellSort(
                     j ← j − gap
 
                 A[j] ← temp
-
-            gap ← gap / 2        // next smaller gap
     */
 
     /*
@@ -161,10 +181,10 @@ void arrayShellSort(
        Let n = length(A).
 
        Shell sort's time complexity depends on the chosen gap sequence.
-       Here:
-         - initial gap is Hibbard-like (2^k − 1),
-         - but the update rule is gap >>= 1 (halving), which is not the standard
-           Hibbard sequence (which would typically go ... 15, 7, 3, 1).
+       Here SHELL_GAP_SEQUENCE selects it:
+         - Hibbard (2^k − 1, the default): O(n^(3/2)) worst case,
+         - Knuth ((3^k − 1) / 2): O(n^(3/2)) worst case,
+         - Ciura (measured, then ×2.25): no proven bound, fastest in practice.
 
        Per-gap work:
          A gapped insertion sort pass is O(n²) in the worst case (like insertion sort)
@@ -187,7 +207,7 @@ void arrayShellSort(
        m(n) = c
 
        Shell sort is in-place; gapped insertion uses only a constant number of
-       temporaries and indices.
+       temporaries and indices, and the gaps fit a fixed SHELL_MAX_GAPS table.
 
        𝒪[m(n)]
         = 𝒪[1]
@@ -207,9 +227,12 @@ void arrayShellSort(
     const size_t length = arrayLength(array);
     if (length < 2) return;
 
-    // Start with largest Hibbard gap
-    for (size_t gap = shellInitialGap(length); gap > 0; gap >>= 1) {
-        shellGappedInsertionSort(array, length, gap, key);
+    size_t gaps[SHELL_MAX_GAPS];
+    size_t gap_count = shellGaps(length, gaps);
+
+    // Largest gap first
+    while (gap_count > 0) {
+        shellGappedInsertionSort(array, length, gaps[--gap_count], key);
     }
 }
 
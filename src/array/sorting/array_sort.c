@@ -0,0 +1,509 @@
+/// Adaptive sort dispatcher | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_sort_context.h"
+#include "../../internal/bds_sort_network.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>  // memset
+
+/**
+ * arraySort() picks the algorithm from the data instead of the caller.
+ *
+ * Every key is read exactly once, into the key cache, and every path below
+ * runs on the cache. The first keys go in through a probe that stops at the
+ * first element breaking the order (within a few elements on unordered
+ * input): if it reaches the end, the Array was ascending (nothing to do) or
+ * strictly descending (reversed in place), and the cache is dropped.
+ *
+ * Otherwise the rest of the cache is filled, then profiled for the turns
+ * (a descent key[i] < key[i − 1] next to an ascent, which bounds TimSort's
+ * natural runs in either direction) and the key range max − min.
+ *
+ *   key range < n                     → counting sort (one histogram,
+ *                                       one scatter; stable)
+ *   n ≤ 256 (cache on the stack)      → TimSort if long runs or STABLE,
+ *                                       else pdqsort
+ *   long natural runs (avg ≥ 128)     → TimSort
+ *   few distinct keys (hashed sample) → counting sort over the distinct
+ *     and STABLE or n ≥ 512             keys (stable)
+ *   STABLE, dense keys or random      → LSD radix (constant digits are
+ *                                       skipped)
+ *   STABLE, otherwise                 → TimSort
+ *   random or dense, 512 ≤ n ≤ 2^17   → LSD radix (scratch stays in L2)
+ *   otherwise                         → pdqsort (3-way on duplicates)
+ *
+ * The counting sorts and radix scatter the payloads straight into
+ * Array->data, so they skip the write-back as well. The thresholds come
+ * from benches/bench_sort.c.
+ */
+
+#define ADAPTIVE_NETWORK_MAX_LENGTH 16       // up to here the network beats caching keys
+#define ADAPTIVE_SMALL_LENGTH       256      // up to here the cache and scratch live on the stack
+#define ADAPTIVE_RUN_RATIO          128      // ≤ n / ratio turns ⇒ TimSort merges the runs
+#define ADAPTIVE_RANDOM_RATIO       3        // > n / ratio turns ⇒ no usable order (random: 2n / 3)
+#define ADAPTIVE_RADIX_MIN_LENGTH   512      // below this radix's histograms dominate
+#define ADAPTIVE_RADIX_MAX_LENGTH   131072   // above this pdqsort beats radix on random keys
+#define ADAPTIVE_DENSE_RANGE        65536u   // max − min below this ⇒ ≤ 2 radix passes
+
+#define ADAPTIVE_SAMPLE_LENGTH      64       // keys hashed to estimate the distinct count
+#define ADAPTIVE_SAMPLE_DISTINCT    16       // at most this many distinct in the sample ⇒ try counting
+#define ADAPTIVE_DISTINCT_MIN_LENGTH 512     // below this pdqsort beats the unstable distinct counting
+#define ADAPTIVE_DISTINCT_BITS      8
+#define ADAPTIVE_DISTINCT_SLOTS     (1u << ADAPTIVE_DISTINCT_BITS)
+#define ADAPTIVE_DISTINCT_MAX       (ADAPTIVE_DISTINCT_SLOTS >> 1)  // table at most half full
+
+_Static_assert(ADAPTIVE_NETWORK_MAX_LENGTH <= SORT_NETWORK_MAX_LENGTH, "network leaf too long");
+_Static_assert(ADAPTIVE_SAMPLE_LENGTH <= ADAPTIVE_DISTINCT_MAX, "sample must fit the distinct table");
+
+typedef enum adaptive_order {
+    ADAPTIVE_UNORDERED,
+    ADAPTIVE_ASCENDING,
+    ADAPTIVE_DESCENDING,  // strictly
+} AdaptiveOrder;
+
+typedef struct adaptive_profile {
+    size_t turns;    // direction changes; every natural run but the first starts at one
+    int min_key;
+    uint32_t range;  // max − min as an unsigned distance
+} AdaptiveProfile;
+
+/// ===============================================================
+/// Probe and profile
+/// ===============================================================
+
+/**
+ * Caches keys until the first one that breaks the leading run (it is cached
+ * too) and stores in *filled how many items are cached. Reports whether the
+ * run spans the whole Array.
+ */
+static AdaptiveOrder adaptiveProbe(KeyedItem *items, const Array *array, const key_val_func key, size_t *filled) {
+    const size_t length = arrayLength(array);
+    void **data = array->data;
+
+    items[0].key = key(data[0]);
+    items[0].ptr = data[0];
+    items[1].key = key(data[1]);
+    items[1].ptr = data[1];
+
+    const bool descending = items[1].key < items[0].key;
+    size_t idx = 2;
+
+    if (descending) {
+        for (; idx < length; idx++) {
+            items[idx].key = key(data[idx]);
+            items[idx].ptr = data[idx];
+            if (items[idx].key >= items[idx - 1].key) break;
+        }
+    } else {
+        for (; idx < length; idx++) {
+            items[idx].key = key(data[idx]);
+            items[idx].ptr = data[idx];
+            if (items[idx].key < items[idx - 1].key) break;
+        }
+    }
+
+    *filled = idx < length ? idx + 1 : length;
+    BDS_STATS_ADD(key_calls, *filled);
+    BDS_STATS_ADD(compares, *filled - 1);
+
+    if (idx < length) return ADAPTIVE_UNORDERED;
+    return descending ? ADAPTIVE_DESCENDING : ADAPTIVE_ASCENDING;
+}
+
+// Strictly descending: reversing keeps it stable
+static void adaptiveReverse(Array *array) {
+    void **data = array->data;
+    BDS_STATS_ADD(swaps, array->length >> 1);
+
+    for (size_t lo = 0, hi = array->length - 1; lo < hi; lo++, hi--) {
+        void *temp = data[lo];
+        data[lo] = data[hi];
+        data[hi] = temp;
+    }
+}
+
+/**
+ * Caches the keys the probe left, then profiles the whole cache. Two loops
+ * beat one: around the key() call the profile's state would not stay in
+ * registers, and the second loop reads the cache while it is still hot.
+ */
+static AdaptiveProfile adaptiveFillProfile(
+    KeyedItem *items,
+    const Array *array,
+    const key_val_func key,
+    const size_t filled
+) {
+    const size_t length = arrayLength(array);
+    BDS_STATS_ADD(key_calls, length - filled);
+
+    for (size_t i = filled; i < length; i++) {
+        if (i + KEY_CACHE_PREFETCH_DISTANCE < length) {
+            BDS_PREFETCH(array->data[i + KEY_CACHE_PREFETCH_DISTANCE]);
+        }
+
+        void *datapoint = array->data[i];
+
+        items[i].key = key(datapoint);
+        items[i].ptr = datapoint;
+    }
+
+    int prev = items[0].key;
+
+    // Branch-free, so unordered input costs no mispredictions
+    size_t turns = 0;
+    int min_key = prev;
+    int max_key = prev;
+    bool was_descent = false;
+
+    for (size_t i = 1; i < length; i++) {
+        const int cur = items[i].key;
+
+        const bool descent = cur < prev;
+        turns += descent != was_descent;
+        was_descent = descent;
+
+        min_key = cur < min_key ? cur : min_key;
+        max_key = cur > max_key ? cur : max_key;
+        prev = cur;
+    }
+
+    return (AdaptiveProfile){ turns, min_key, (uint32_t)max_key - (uint32_t)min_key };
+}
+
+/// ===============================================================
+/// Counting sorts (stable, scatter into Array->data)
+/// ===============================================================
+
+/**
+ * One histogram over key − min, one scatter. False on OOM (nothing moved).
+ */
+static bool adaptiveCountingSort(Array *array, const KeyedItem *items, const AdaptiveProfile *profile) {
+    const size_t length = arrayLength(array);
+    const size_t buckets = (size_t)profile->range + 1;
+
+    size_t small_offsets[ADAPTIVE_SMALL_LENGTH] = {0};
+
+    size_t *offsets = buckets <= ADAPTIVE_SMALL_LENGTH ? small_offsets : (size_t *)calloc(buckets, sizeof(size_t));
+    if (!offsets) return false;
+
+    for (size_t i = 0; i < length; i++) {
+        offsets[(uint32_t)items[i].key - (uint32_t)profile->min_key]++;
+    }
+
+    // Exclusive prefix sum ⇒ first output slot for each key
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < buckets; bucket++) {
+        const size_t count = offsets[bucket];
+        offsets[bucket] = offset;
+        offset += count;
+    }
+
+    BDS_STATS_ADD(writes, length);
+
+    for (size_t i = 0; i < length; i++) {
+        array->data[offsets[(uint32_t)items[i].key - (uint32_t)profile->min_key]++] = items[i].ptr;
+    }
+
+    if (offsets != small_offsets) free(offsets);
+    return true;
+}
+
+// Open addressing; only `used` needs clearing, a slot's key and count are set when it is claimed
+typedef struct adaptive_distinct_table {
+    size_t distinct;
+    bool used[ADAPTIVE_DISTINCT_SLOTS];
+    int keys[ADAPTIVE_DISTINCT_SLOTS];
+    size_t counts[ADAPTIVE_DISTINCT_SLOTS];  // then: next output slot for the key
+} AdaptiveDistinctTable;
+
+static void adaptiveDistinctInit(AdaptiveDistinctTable *table) {
+    table->distinct = 0;
+    memset(table->used, 0, sizeof(table->used));
+}
+
+// MurmurHash3's finalizer: keys in arithmetic progression would cluster under a plain multiply
+static inline size_t adaptiveDistinctHash(const int key) {
+    uint32_t hash = (uint32_t)key;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+
+    return hash >> (32 - ADAPTIVE_DISTINCT_BITS);
+}
+
+/**
+ * Slot of `key`, claimed if `key` is new.
+ * SIZE_MAX once the distinct count would pass ADAPTIVE_DISTINCT_MAX.
+ */
+static size_t adaptiveDistinctSlot(AdaptiveDistinctTable *table, const int key) {
+    size_t slot = adaptiveDistinctHash(key);
+
+    while (table->used[slot]) {
+        if (table->keys[slot] == key) return slot;
+        slot = (slot + 1) & (ADAPTIVE_DISTINCT_SLOTS - 1);
+    }
+
+    if (table->distinct == ADAPTIVE_DISTINCT_MAX) return SIZE_MAX;
+    table->distinct++;
+
+    table->used[slot] = true;
+    table->keys[slot] = key;
+    table->counts[slot] = 0;
+
+    return slot;
+}
+
+// Hashes ADAPTIVE_SAMPLE_LENGTH evenly spaced keys; true if few of them differ (stops at the first too many)
+static bool adaptiveFewDistinct(const KeyedItem *items, const size_t length) {
+    AdaptiveDistinctTable table;
+    adaptiveDistinctInit(&table);
+
+    const size_t stride = length / ADAPTIVE_SAMPLE_LENGTH;
+
+    for (size_t i = 0; i < ADAPTIVE_SAMPLE_LENGTH; i++) {
+        adaptiveDistinctSlot(&table, items[i * stride].key);
+        if (table.distinct > ADAPTIVE_SAMPLE_DISTINCT) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Counting sort over the distinct keys, however far apart: count each key
+ * in a small hash table, order the keys, scatter. False (nothing moved) as
+ * soon as more than ADAPTIVE_DISTINCT_MAX distinct keys turn up.
+ */
+static bool adaptiveDistinctSort(Array *array, const KeyedItem *items) {
+    const size_t length = arrayLength(array);
+
+    AdaptiveDistinctTable table;
+    adaptiveDistinctInit(&table);
+
+    for (size_t i = 0; i < length; i++) {
+        const size_t slot = adaptiveDistinctSlot(&table, items[i].key);
+        if (slot == SIZE_MAX) return false;
+
+        table.counts[slot]++;
+    }
+
+    // The used slots in key order (insertion sort: at most ADAPTIVE_DISTINCT_MAX of them)
+    size_t order[ADAPTIVE_DISTINCT_MAX];
+    size_t used = 0;
+
+    for (size_t slot = 0; slot < ADAPTIVE_DISTINCT_SLOTS; slot++) {
+        if (!table.used[slot]) continue;
+
+        size_t pos = used++;
+        while (pos > 0 && table.keys[order[pos - 1]] > table.keys[slot]) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = slot;
+    }
+
+    size_t offset = 0;
+    for (size_t rank = 0; rank < used; rank++) {
+        const size_t count = table.counts[order[rank]];
+        table.counts[order[rank]] = offset;
+        offset += count;
+    }
+
+    BDS_STATS_ADD(writes, length);
+
+    for (size_t i = 0; i < length; i++) {
+        const size_t slot = adaptiveDistinctSlot(&table, items[i].key);
+        array->data[table.counts[slot]++] = items[i].ptr;
+    }
+
+    return true;
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+// n ≤ ADAPTIVE_SMALL_LENGTH: the same probe and counting sort, else pdqsort or TimSort; no heap
+static void adaptiveSortSmall(Array *array, const key_val_func key, const bool stable) {
+    const size_t length = arrayLength(array);
+
+    KeyedItem items[ADAPTIVE_SMALL_LENGTH];
+    KeyedItem scratch[KEYED_TIM_SCRATCH_LENGTH(ADAPTIVE_SMALL_LENGTH)];
+
+    size_t filled;
+    const AdaptiveOrder order = adaptiveProbe(items, array, key, &filled);
+
+    if (order == ADAPTIVE_DESCENDING) adaptiveReverse(array);
+    if (order != ADAPTIVE_UNORDERED) return;
+
+    const AdaptiveProfile profile = adaptiveFillProfile(items, array, key, filled);
+
+    if (profile.range < length && adaptiveCountingSort(array, items, &profile)) return;
+
+    if (stable || profile.turns <= length / ADAPTIVE_RUN_RATIO) keyedTimSortWith(items, scratch, length);
+    else keyedPdqSort(items, length);
+
+    keyCacheWriteBack(array, items);
+}
+
+// No room for the key cache: the Array-level sorts need less (and call key() more often)
+static void adaptiveSortFallback(Array *array, const key_val_func key, const bool stable) {
+    if (stable) arrayTimSort(array, key);
+    else arrayIntroSort(array, key);
+}
+
+void arraySort(Array *array, const key_val_func key, const unsigned int flags) {
+    /*
+    SORT(A, key, flags)
+        n ← length(A)
+        if n ≤ 16 then
+            NETWORK-SORT-RANGE(A, 0, n, key) ; return
+
+        C ← (key(A[i]), A[i]) for the leading run of A and the element after it
+        if the run is all of A then
+            if it is strictly descending then REVERSE(A)
+            return
+        C ← (key(A[i]), A[i]) for the rest of A
+        t ← |{ i : (C[i].key < C[i − 1].key) ≠ (C[i − 1].key < C[i − 2].key) }|   // turns
+        r ← max(C.key) − min(C.key)
+        runs ← t ≤ n / 128
+        if r < n then COUNTING-SORT(C → A) ; return
+        if n ≤ 256 then
+            if runs or STABLE ∈ flags then TIM-SORT(C) else PDQ-SORT(C)
+        else if runs then TIM-SORT(C)
+        else
+            few ← ≤ 16 distinct keys in a 64-key sample
+            if few and (STABLE ∈ flags or n ≥ 512)
+               and C has ≤ 128 distinct keys then DISTINCT-COUNTING-SORT(C → A) ; return
+            dense ← r < 2^16
+            random ← n ≥ 512 and t > n / 3
+            if STABLE ∈ flags then
+                if dense or random then RADIX-SORT(C → A) ; return
+                TIM-SORT(C)
+            else if (random or dense) and not few and 512 ≤ n ≤ 2^17 then RADIX-SORT(C → A) ; return
+            else PDQ-SORT(C)
+
+        A[i] ← C[i].ptr for all i
+    */
+
+    /* Time Complexity Analysis:
+       Let n = length(A). key() is called exactly n times (the probe's keys
+       stay in the cache); only when the cache cannot be allocated do the
+       Array-level fallbacks call it Θ(n log n) times. The profile is one
+       more pass over the cache, the distinct-key sample at most 64 keys.
+
+       Sorted / reversed:     Θ(n)
+       r natural runs:        Θ(n log r)       (TimSort)
+       Key range < n:         Θ(n)             (counting sort)
+       ≤ 128 distinct keys:   Θ(n)             (counting sort over the distinct keys)
+       Dense / random keys:   Θ(n)             (≤ 4 radix passes)
+       Otherwise:             Θ(n log n)       (pdqsort / TimSort)
+
+       𝒪[T(n)]
+        = 𝒪[n log n]
+    */
+
+    /* Additional Memory Analysis:
+       n ≤ 256:            m(n) = 0 on the heap (cache and scratch on the stack)
+       Otherwise:          m(n) = n pairs (key cache)
+                                  + ≤ n counters (counting sort) or ≤ n pairs (radix / TimSort scratch)
+
+       𝒪[m(n)]
+        = 𝒪[n]
+    */
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    if (length <= ADAPTIVE_NETWORK_MAX_LENGTH) {
+        sortNetworkSortRange(array, 0, length, key);
+        return;
+    }
+
+    const bool stable = (flags & BDS_SORT_STABLE) != 0;
+
+    if (length <= ADAPTIVE_SMALL_LENGTH) {
+        adaptiveSortSmall(array, key, stable);
+        return;
+    }
+
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    KeyedItem *items = sortContextItems(&ctx, length);
+    if (!items) {
+        adaptiveSortFallback(array, key, stable);
+        return;
+    }
+
+    size_t filled;
+    const AdaptiveOrder order = adaptiveProbe(items, array, key, &filled);
+
+    if (order != ADAPTIVE_UNORDERED) {
+        if (order == ADAPTIVE_DESCENDING) adaptiveReverse(array);
+        sortContextRelease(&ctx);
+        return;
+    }
+
+    const AdaptiveProfile profile = adaptiveFillProfile(items, array, key, filled);
+
+    const bool runs = profile.turns <= length / ADAPTIVE_RUN_RATIO;
+
+    if (profile.range < length && adaptiveCountingSort(array, items, &profile)) {
+        sortContextRelease(&ctx);
+        return;
+    }
+
+    // Few distinct keys: counting over them, or while n is small pdqsort's 3-way partitions
+    const bool few = !runs && profile.range >= length && adaptiveFewDistinct(items, length);
+
+    if (few && (stable || length >= ADAPTIVE_DISTINCT_MIN_LENGTH) && adaptiveDistinctSort(array, items)) {
+        sortContextRelease(&ctx);
+        return;
+    }
+
+    const bool random = length >= ADAPTIVE_RADIX_MIN_LENGTH && profile.turns > length / ADAPTIVE_RANDOM_RATIO;
+    const bool dense  = profile.range < ADAPTIVE_DENSE_RANGE;
+
+    const bool use_radix = !runs && (stable
+        ? dense || random
+        : !few && (dense || random) && length >= ADAPTIVE_RADIX_MIN_LENGTH && length <= ADAPTIVE_RADIX_MAX_LENGTH);
+
+    if (use_radix) {
+        KeyedItem *scratch = sortContextScratch(&ctx, length);
+
+        if (scratch) keyedRadixSort(items, scratch, length, array->data);  // Writes the payloads back itself
+
+        sortContextRelease(&ctx);
+        if (!scratch) adaptiveSortFallback(array, key, stable);
+        return;
+    }
+
+    if (runs || stable) {
+        KeyedItem *scratch = sortContextScratch(&ctx, KEYED_TIM_SCRATCH_LENGTH(length));
+        if (!scratch) {
+            sortContextRelease(&ctx);
+            adaptiveSortFallback(array, key, stable);
+            return;
+        }
+
+        keyedTimSortWith(items, scratch, length);
+    } else {
+        keyedPdqSort(items, length);
+    }
+
+    keyCacheWriteBack(array, items);
+    sortContextRelease(&ctx);
+}
+
+Array *arraySorted(const Array *array, const key_val_func key, const unsigned int flags) {
+    Array *sorted_array = arrayShallowCopy(array);
+    if (!sorted_array) return NULL;
+
+    arraySort(sorted_array, key, flags);
+
+    return sorted_array;
+}
@@ -0,0 +1,116 @@
+/// Reusable sort workspace | ARR
+
+#include "../../../include/bds/array/bds_array_sort.h"
+#include "../../../include/bds/bds_config.h"
+#include "../../internal/bds_sort_context.h"
+
+#include <stdlib.h>
+
+/**
+ * A sort that needs scratch memory asks the context for it instead of
+ * calling malloc. Buffers grow geometrically and are never shrunk, so once
+ * a context has seen the largest input of a workload every further sort
+ * runs without touching the heap.
+ */
+
+/// ===============================================================
+/// Growth
+/// ===============================================================
+
+/**
+ * Returns `buffer` if it holds at least `count` elements of `elem_size` bytes,
+ * otherwise a bigger replacement (the old one is freed, its contents dropped;
+ * free + malloc is cheaper than realloc's copy). NULL on OOM, `buffer` kept.
+ */
+static void *sortContextGrow(void *buffer, size_t *capacity, const size_t count, const size_t elem_size) {
+    if (count <= *capacity) return buffer;
+
+    size_t new_cap = (size_t)((double)*capacity * (ARRAY_GEOMETRIC_EXPANSION_RATIO + 1.0)) + 1;
+    if (new_cap < count) new_cap = count;
+
+    void *grown = malloc(new_cap * elem_size);
+    if (!grown) return NULL;
+
+    free(buffer);
+    *capacity = new_cap;
+
+    return grown;
+}
+
+void **sortContextPointers(BdsSortContext *ctx, const size_t count) {
+    void **pointers = (void **)sortContextGrow(ctx->pointers, &ctx->pointer_capacity, count, sizeof(void *));
+    if (pointers) ctx->pointers = pointers;
+
+    return pointers;
+}
+
+KeyedItem *sortContextItems(BdsSortContext *ctx, const size_t count) {
+    KeyedItem *items = (KeyedItem *)sortContextGrow(ctx->items, &ctx->item_capacity, count, sizeof(KeyedItem));
+    if (items) ctx->items = items;
+
+    return items;
+}
+
+KeyedItem *sortContextScratch(BdsSortContext *ctx, const size_t count) {
+    KeyedItem *scratch = (KeyedItem *)sortContextGrow(ctx->scratch, &ctx->scratch_capacity, count, sizeof(KeyedItem));
+    if (scratch) ctx->scratch = scratch;
+
+    return scratch;
+}
+
+KeyedItem *sortContextKeyCache(BdsSortContext *ctx, const Array *array, const key_val_func key) {
+    const size_t length = arrayLength(array);
+    if (length == 0) return NULL;
+
+    KeyedItem *items = sortContextItems(ctx, length);
+    if (!items) return NULL;
+
+    keyCacheFill(items, array, key);
+
+    return items;
+}
+
+void sortContextRelease(BdsSortContext *ctx) {
+    free(ctx->pointers);
+    free(ctx->items);
+    free(ctx->scratch);
+
+    ctx->pointers = NULL;
+    ctx->items    = NULL;
+    ctx->scratch  = NULL;
+
+    ctx->pointer_capacity = 0;
+    ctx->item_capacity    = 0;
+    ctx->scratch_capacity = 0;
+}
+
+/// ===============================================================
+/// Public API
+/// ===============================================================
+
+BdsSortContext *sortContextNew(void) {
+    BdsSortContext *ctx = (BdsSortContext *)malloc(sizeof(BdsSortContext));
+    if (!ctx) return NULL;
+
+    const BdsSortContext empty = SORT_CONTEXT_EMPTY;
+    *ctx = empty;
+
+    return ctx;
+}
+
+bool sortContextReserve(BdsSortContext *ctx, const size_t length) {
+    if (!ctx) return false;
+    if (length == 0) return true;
+
+    // Enough for any *Ctx sort of up to `length` elements
+    return sortContextPointers(ctx, length) &&
+           sortContextItems(ctx, length) &&
+           sortContextScratch(ctx, length);
+}
+
+void sortContextFree(BdsSortContext *ctx) {
+    if (!ctx) return;
+
+    sortContextRelease(ctx);
+    free(ctx);
+}
@@ -0,0 +1,349 @@
+/// Sorting networks (leaf kernel) | ARR
+
+#include "../../internal/bds_sort_network.h"
+
+#include <string.h>  // memcpy
+
+/**
+ * Comparator networks for 2..16 elements with the fewest known
+ * compare-exchanges (CEs): 1, 3, 5, 9, 12, 16, 19, 25, 29, 35, 39, 45,
+ * 51, 56, 60. Sizes 14 and 15 are Green's 16-input network with the
+ * unused wires pruned. Every table was checked against all 2^n 0-1
+ * inputs (0-1 principle).
+ *
+ * Larger leaves:
+ *   17..31  two networks + branchless merge
+ *   32      two 16-networks + bitonic merge (80 CEs)
+ *   33..64  a 32-leaf + a network on the rest + branchless merge
+ *
+ * SIMD min/max was considered but not used: the ranks are 64-bit and
+ * SSE4.1/AVX2 have no unsigned 64-bit min/max, so a scalar cmov is
+ * what the compilers emit anyway.
+ */
+
+/// ===============================================================
+/// Networks (pairs are (i, j) with i < j; listed layer by layer)
+/// ===============================================================
+
+static const unsigned char SORT_NETWORK_2[][2] = {  // 1 CE, 1 layer
+    {0, 1},
+};
+
+static const unsigned char SORT_NETWORK_3[][2] = {  // 3 CEs, 3 layers
+    {0, 2},
+    {0, 1},
+    {1, 2},
+};
+
+static const unsigned char SORT_NETWORK_4[][2] = {  // 5 CEs, 3 layers
+    {0, 2}, {1, 3},
+    {0, 1}, {2, 3},
+    {1, 2},
+};
+
+static const unsigned char SORT_NETWORK_5[][2] = {  // 9 CEs, 5 layers
+    {0, 3}, {1, 4},
+    {0, 2}, {1, 3},
+    {0, 1}, {2, 4},
+    {1, 2}, {3, 4},
+    {2, 3},
+};
+
+static const unsigned char SORT_NETWORK_6[][2] = {  // 12 CEs, 5 layers
+    {0, 5}, {1, 3}, {2, 4},
+    {1, 2}, {3, 4},
+    {0, 3}, {2, 5},
+    {0, 1}, {2, 3}, {4, 5},
+    {1, 2}, {3, 4},
+};
+
+static const unsigned char SORT_NETWORK_7[][2] = {  // 16 CEs, 6 layers
+    {0, 6}, {2, 3}, {4, 5},
+    {0, 2}, {1, 4}, {3, 6},
+    {0, 1}, {2, 5}, {3, 4},
+    {1, 2}, {4, 6},
+    {2, 3}, {4, 5},
+    {1, 2}, {3, 4}, {5, 6},
+};
+
+static const unsigned char SORT_NETWORK_8[][2] = {  // 19 CEs, 6 layers
+    {0, 2}, {1, 3}, {4, 6}, {5, 7},
+    {0, 4}, {1, 5}, {2, 6}, {3, 7},
+    {0, 1}, {2, 3}, {4, 5}, {6, 7},
+    {2, 4}, {3, 5},
+    {1, 4}, {3, 6},
+    {1, 2}, {3, 4}, {5, 6},
+};
+
+static const unsigned char SORT_NETWORK_9[][2] = {  // 25 CEs, 7 layers
+    {0, 3}, {1, 7}, {2, 5}, {4, 8},
+    {0, 7}, {2, 4}, {3, 8}, {5, 6},
+    {0, 2}, {1, 3}, {4, 5}, {7, 8},
+    {1, 4}, {3, 6}, {5, 7},
+    {0, 1}, {2, 4}, {3, 5}, {6, 8},
+    {2, 3}, {4, 5}, {6, 7},
+    {1, 2}, {3, 4}, {5, 6},
+};
+
+static const unsigned char SORT_NETWORK_10[][2] = {  // 29 CEs, 8 layers
+    {0, 8}, {1, 9}, {2, 7}, {3, 5}, {4, 6},
+    {0, 2}, {1, 4}, {5, 8}, {7, 9},
+    {0, 3}, {2, 4}, {5, 7}, {6, 9},
+    {0, 1}, {3, 6}, {8, 9},
+    {1, 5}, {2, 3}, {4, 8}, {6, 7},
+    {1, 2}, {3, 5}, {4, 6}, {7, 8},
+    {2, 3}, {4, 5}, {6, 7},
+    {3, 4}, {5, 6},
+};
+
+static const unsigned char SORT_NETWORK_11[][2] = {  // 35 CEs, 8 layers
+    {0, 9}, {1, 6}, {2, 4}, {3, 7}, {5, 8},
+    {0, 1}, {3, 5}, {4, 10}, {6, 9}, {7, 8},
+    {1, 3}, {2, 5}, {4, 7}, {8, 10},
+    {0, 4}, {1, 2}, {3, 7}, {5, 9}, {6, 8},
+    {0, 1}, {2, 6}, {4, 5}, {7, 8}, {9, 10},
+    {2, 4}, {3, 6}, {5, 7}, {8, 9},
+    {1, 2}, {3, 4}, {5, 6}, {7, 8},
+    {2, 3}, {4, 5}, {6, 7},
+};
+
+static const unsigned char SORT_NETWORK_12[][2] = {  // 39 CEs, 9 layers
+    {0, 8}, {1, 7}, {2, 6}, {3, 11}, {4, 10}, {5, 9},
+    {0, 1}, {2, 5}, {3, 4}, {6, 9}, {7, 8}, {10, 11},
+    {0, 2}, {1, 6}, {5, 10}, {9, 11},
+    {0, 3}, {1, 2}, {4, 6}, {5, 7}, {8, 11}, {9, 10},
+    {1, 4}, {3, 5}, {6, 8}, {7, 10},
+    {1, 3}, {2, 5}, {6, 9}, {8, 10},
+    {2, 3}, {4, 5}, {6, 7}, {8, 9},
+    {4, 6}, {5, 7},
+    {3, 4}, {5, 6}, {7, 8},
+};
+
+static const unsigned char SORT_NETWORK_13[][2] = {  // 45 CEs, 10 layers
+    {0, 12}, {1, 10}, {2, 9}, {3, 7}, {5, 11}, {6, 8},
+    {1, 6}, {2, 3}, {4, 11}, {7, 9}, {8, 10},
+    {0, 4}, {1, 2}, {3, 6}, {7, 8}, {9, 10}, {11, 12},
+    {4, 6}, {5, 9}, {8, 11}, {10, 12},
+    {0, 5}, {3, 8}, {4, 7}, {6, 11}, {9, 10},
+    {0, 1}, {2, 5}, {6, 9}, {7, 8}, {10, 11},
+    {1, 3}, {2, 4}, {5, 6}, {9, 10},
+    {1, 2}, {3, 4}, {5, 7}, {6, 8},
+    {2, 3}, {4, 5}, {6, 7}, {8, 9},
+    {3, 4}, {5, 6},
+};
+
+static const unsigned char SORT_NETWORK_14[][2] = {  // 51 CEs, 10 layers
+    {0, 13}, {1, 12}, {4, 8}, {5, 6}, {7, 11}, {9, 10},
+    {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {11, 12},
+    {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13},
+    {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9},
+    {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11},
+    {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13},
+    {2, 4}, {3, 6}, {9, 12}, {11, 13},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12},
+    {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+    {6, 7}, {8, 9},
+};
+
+static const unsigned char SORT_NETWORK_15[][2] = {  // 56 CEs, 10 layers
+    {0, 13}, {1, 12}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10},
+    {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {11, 12},
+    {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13},
+    {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14},
+    {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14},
+    {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14},
+    {2, 4}, {3, 6}, {9, 12}, {11, 13},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12},
+    {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+    {6, 7}, {8, 9},
+};
+
+static const unsigned char SORT_NETWORK_16[][2] = {  // 60 CEs, 10 layers
+    {0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10},
+    {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {10, 15}, {11, 12},
+    {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13}, {14, 15},
+    {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14}, {13, 15},
+    {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14},
+    {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14},
+    {2, 4}, {3, 6}, {9, 12}, {11, 13},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12},
+    {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+    {6, 7}, {8, 9},
+};
+
+typedef struct sort_network {
+    const unsigned char (*pairs)[2];
+    size_t count;
+} SortNetwork;
+
+static const SortNetwork SORT_NETWORKS[17] = {
+    [2] = { SORT_NETWORK_2, sizeof(SORT_NETWORK_2) / sizeof(SORT_NETWORK_2[0]) },
+    [3] = { SORT_NETWORK_3, sizeof(SORT_NETWORK_3) / sizeof(SORT_NETWORK_3[0]) },
+    [4] = { SORT_NETWORK_4, sizeof(SORT_NETWORK_4) / sizeof(SORT_NETWORK_4[0]) },
+    [5] = { SORT_NETWORK_5, sizeof(SORT_NETWORK_5) / sizeof(SORT_NETWORK_5[0]) },
+    [6] = { SORT_NETWORK_6, sizeof(SORT_NETWORK_6) / sizeof(SORT_NETWORK_6[0]) },
+    [7] = { SORT_NETWORK_7, sizeof(SORT_NETWORK_7) / sizeof(SORT_NETWORK_7[0]) },
+    [8] = { SORT_NETWORK_8, sizeof(SORT_NETWORK_8) / sizeof(SORT_NETWORK_8[0]) },
+    [9] = { SORT_NETWORK_9, sizeof(SORT_NETWORK_9) / sizeof(SORT_NETWORK_9[0]) },
+    [10] = { SORT_NETWORK_10, sizeof(SORT_NETWORK_10) / sizeof(SORT_NETWORK_10[0]) },
+    [11] = { SORT_NETWORK_11, sizeof(SORT_NETWORK_11) / sizeof(SORT_NETWORK_11[0]) },
+    [12] = { SORT_NETWORK_12, sizeof(SORT_NETWORK_12) / sizeof(SORT_NETWORK_12[0]) },
+    [13] = { SORT_NETWORK_13, sizeof(SORT_NETWORK_13) / sizeof(SORT_NETWORK_13[0]) },
+    [14] = { SORT_NETWORK_14, sizeof(SORT_NETWORK_14) / sizeof(SORT_NETWORK_14[0]) },
+    [15] = { SORT_NETWORK_15, sizeof(SORT_NETWORK_15) / sizeof(SORT_NETWORK_15[0]) },
+    [16] = { SORT_NETWORK_16, sizeof(SORT_NETWORK_16) / sizeof(SORT_NETWORK_16[0]) },
+};
+
+/// ===============================================================
+/// Ranks
+/// ===============================================================
+
+// Flipping the sign bit makes unsigned order match signed key order
+static inline uint64_t sortNetworkRank(const int key, const size_t position) {
+    return ((uint64_t)((uint32_t)key ^ 0x80000000u) << 32) | (uint64_t)position;
+}
+
+static inline size_t sortNetworkPosition(const uint64_t rank) {
+    return (size_t)(rank & 0xFFFFFFFFu);
+}
+
+/// ===============================================================
+/// Kernel
+/// ===============================================================
+
+// Branchless: compiles to cmp + cmov
+static inline void sortNetworkCompareExchange(uint64_t *ranks, const size_t i, const size_t j) {
+    BDS_STATS_ADD(compares, 1);
+
+    const uint64_t a = ranks[i];
+    const uint64_t b = ranks[j];
+    const uint64_t lo = a < b ? a : b;
+
+    ranks[i] = lo;
+    ranks[j] = a ^ b ^ lo;
+}
+
+static void sortNetworkApply(uint64_t *ranks, const SortNetwork *network) {
+    for (size_t k = 0; k < network->count; k++) {
+        sortNetworkCompareExchange(ranks, network->pairs[k][0], network->pairs[k][1]);
+    }
+}
+
+/**
+ * Merges two sorted halves of 16 into a sorted 32: one flip layer
+ * (i against 31 − i) turns them into two bitonic halves, then
+ * half-cleaners of width 8, 4, 2, 1 finish each half.
+ */
+static void sortNetworkBitonicMerge32(uint64_t *ranks) {
+    for (size_t i = 0; i < 16; i++) {
+        sortNetworkCompareExchange(ranks, i, 31 - i);
+    }
+
+    for (size_t step = 8; step > 0; step >>= 1) {
+        for (size_t block = 0; block < 32; block += step << 1) {
+            for (size_t i = block; i < block + step; i++) {
+                sortNetworkCompareExchange(ranks, i, i + step);
+            }
+        }
+    }
+}
+
+/**
+ * Branchless merge of sorted left[0, left_len) and right[0, right_len).
+ * Ranks are unique, so no tie handling is needed.
+ */
+static void sortNetworkMerge(
+    const uint64_t *left,
+    const size_t left_len,
+    const uint64_t *right,
+    const size_t right_len,
+    uint64_t *out
+) {
+    size_t left_idx = 0, right_idx = 0, write_idx = 0;
+
+    while (left_idx < left_len && right_idx < right_len) {
+        const uint64_t a = left[left_idx];
+        const uint64_t b = right[right_idx];
+        const size_t take_right = b < a;
+        BDS_STATS_ADD(compares, 1);
+
+        out[write_idx++] = take_right ? b : a;
+        right_idx += take_right;
+        left_idx  += take_right ^ 1u;
+    }
+
+    memcpy(&out[write_idx], &left[left_idx], (left_len - left_idx) * sizeof(uint64_t));
+    write_idx += left_len - left_idx;
+    memcpy(&out[write_idx], &right[right_idx], (right_len - right_idx) * sizeof(uint64_t));
+}
+
+void sortNetworkRanks(uint64_t *ranks, const size_t length) {
+    if (length < 2) return;
+
+    if (length <= 16) {
+        sortNetworkApply(ranks, &SORT_NETWORKS[length]);
+        return;
+    }
+
+    // Left part is a full 16 (or 32) so it can use the fixed networks
+    const size_t left_len = length <= 32 ? 16u : 32u;
+
+    sortNetworkRanks(ranks, left_len);
+    sortNetworkRanks(ranks + left_len, length - left_len);
+
+    if (length == 32) {
+        sortNetworkBitonicMerge32(ranks);
+        return;
+    }
+
+    uint64_t merged[SORT_NETWORK_MAX_LENGTH];
+    sortNetworkMerge(ranks, left_len, ranks + left_len, length - left_len, merged);
+    memcpy(ranks, merged, length * sizeof(uint64_t));
+}
+
+/// ===============================================================
+/// Front ends
+/// ===============================================================
+
+void keyedNetworkSort(KeyedItem *items, const size_t length) {
+    if (length < 2) return;
+
+    uint64_t ranks[SORT_NETWORK_MAX_LENGTH];
+    KeyedItem sorted[SORT_NETWORK_MAX_LENGTH];
+
+    for (size_t i = 0; i < length; i++) {
+        ranks[i] = sortNetworkRank(items[i].key, i);
+    }
+
+    sortNetworkRanks(ranks, length);
+
+    for (size_t i = 0; i < length; i++) {
+        sorted[i] = items[sortNetworkPosition(ranks[i])];
+    }
+
+    memcpy(items, sorted, length * sizeof(KeyedItem));
+    BDS_STATS_ADD(writes, length);
+}
+
+void sortNetworkSortRange(Array *array, const size_t lo, const size_t hi, const key_val_func key) {
+    const size_t length = hi - lo;
+    if (length < 2) return;
+
+    BDS_STATS_ADD(key_calls, length);
+
+    uint64_t ranks[SORT_NETWORK_MAX_LENGTH];
+    void *payloads[SORT_NETWORK_MAX_LENGTH];
+
+    for (size_t i = 0; i < length; i++) {
+        payloads[i] = array->data[lo + i];
+        ranks[i] = sortNetworkRank(key(payloads[i]), i);
+    }
+
+    sortNetworkRanks(ranks, length);
+
+    for (size_t i = 0; i < length; i++) {
+        array->data[lo + i] = payloads[sortNetworkPosition(ranks[i])];
+    }
+
+    BDS_STATS_ADD(writes, length);  // Elements are moved by rank, never swapped
+}
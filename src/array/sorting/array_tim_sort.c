@@ -2,11 +2,16 @@
 
 #include "../../../include/bds/array/bds_array_utils.h"
 #include "../../../include/bds/array/bds_array_sort.h"
+#include "../../internal/bds_key_cache.h"
+#include "../../internal/bds_sort_context.h"
+#include "../../internal/bds_sort_network.h"
+#include "../../internal/bds_tuning.h"  // TIM_MIN_MERGE, TIM_STACK_MAX
 
 #include <stdlib.h>
+#include <string.h>  // memcpy, memmove
 
 
-// Hybrid sorting algorithm derived from merge sort and insertion sort.
+// Hybrid sorting algorithm derived from merge sort, with sorting networks for short runs.
 // Uses RUNs of ordered elements to optimize sorting time.
 
 /**
@@ -14,8 +19,8 @@
  * e.g.: [*2*, *3*, *8*, *9*, _7_, _5_, _1_, *2*, *3*, *4*] ---> [2, 3, 8, 9] && [7, 5, 1] && [2, 3, 4]
  * 2. **Normalize runs**: Reverse descending runs to make them ascending.
  * e.g.: [7, 5, 1] ---> [1, 5, 7]
- * 3. **minrun**: Fixed minimum run size (e.g., 32). If a run is smaller, extend it using **insertion sort**
- * **INSERTION SORT WORKS BETTER WITH PARTIALLY SORTED ARRAYS**.
+ * 3. **minrun**: Fixed minimum run size (e.g., 32). If a run is smaller, extend it using a **sorting network**
+ * (keyedNetworkSort on the key cache, sortNetworkSortRange on the Array): stable, and cheap on short runs.
  * 4. **Stack Runs**: Create a stack of runs.
  * R1:[2, 3, 8, 9] && R2:[7, 5, 1] && R3:[2, 3, 4] --> Stack:[R1, R2, R3]
  * 5. **Merge**: Merge runs from the stack while maintaining certain invariants to ensure efficient merging.
@@ -35,7 +40,7 @@
 /**
  * Flow:
  * 1) Detect natural runs (asc/desc) and normalize to ascending.
- * 2) Ensure each run is at least `minrun` via insertion sort.
+ * 2) Ensure each run is at least `minrun` via a sorting network (minrun ≤ TIM_MIN_MERGE ≤ 64).
  * 3) Push runs to a stack and collapse while invariants are violated.
  * 4) Merge runs using galloping (copy blocks when streaks appear).
  */
@@ -45,18 +50,17 @@ typedef struct tim_run {
     size_t length;      // run length
 } TimRun;
 
-#define TIM_STACK_MAX 40  // conservative for very large inputs
-
 /// ===============================================================
 /// minrun computation
 /// ===============================================================
 
 /**
- * Compute TimSort's minimal run length (in [32, 64] for large arrays).
+ * Compute TimSort's minimal run length (in [TIM_MIN_MERGE / 2, TIM_MIN_MERGE]
+ * for large arrays; [32, 64] by default).
  */
 static size_t timMinRun(size_t total_len) {
     size_t rem_bits = 0;
-    while (total_len >= 64) {
+    while (total_len >= TIM_MIN_MERGE) {
         rem_bits |= total_len & 1u;
         total_len >>= 1;
     }
@@ -88,35 +92,6 @@ static void timReverseRange(
     }
 }
 
-/**
- * Stable insertion sort over [low_idx, high_excl_idx).
- */
-static void timInsertionSortRange(
-    Array *array,
-    const size_t low_idx,
-    const size_t high_excl_idx,
-    const key_val_func key
-) {
-    if (high_excl_idx - low_idx < 2) return;
-
-    for (size_t pivot_idx = low_idx + 1; pivot_idx < high_excl_idx; pivot_idx++) {
-        void *pivot_val = arrayGet(array, pivot_idx);
-        size_t scan_idx = pivot_idx;
-
-        // Shift larger elements right
-        while (scan_idx > low_idx) {
-            void *prev_val = arrayGet(array, scan_idx - 1);
-
-            if (arrayKeyCompare(prev_val, pivot_val, key) <= 0) break; // stable
-
-            arraySet(array, scan_idx, prev_val);
-            scan_idx--;
-        }
-
-        arraySet(array, scan_idx, pivot_val);
-    }
-}
-
 /// ===============================================================
 /// Run detection
 /// ===============================================================
@@ -292,16 +267,18 @@ static size_t timGallopRight(
  * Merge two adjacent ascending runs:
  *   left :  [merge_base_idx, merge_base_idx + left_len)
  *   right:  [merge_base_idx + left_len, merge_base_idx + left_len + right_len)
- * Stable; uses a buffer for the left run and galloping for block copies.
+ * Stable; buffers the left run in the workspace and gallops for block copies.
  */
 static void timMergeAt(
     Array *array,
     const size_t merge_base_idx,
     const size_t left_len,
     const size_t right_len,
-    const key_val_func key
+    const key_val_func key,
+    BdsSortContext *ctx
 ) {
-    void **left_buff_arr = (void **)malloc(left_len * sizeof(void *));
+    // Workspace buffer: grows to the largest left run once, then is reused
+    void **left_buff_arr = sortContextPointers(ctx, left_len);
     if (!left_buff_arr) return; // simple OOM behavior
 
     for (size_t copy_idx = 0; copy_idx < left_len; copy_idx++) {
@@ -368,7 +345,6 @@ static void timMergeAt(
     }
 
     // Remaining right elements are already in place
-    free(left_buff_arr);
 }
 
 /// ===============================================================
@@ -376,66 +352,54 @@ static void timMergeAt(
 /// ===============================================================
 
 /**
- * Collapse while simplified TimSort invariants are violated:
- *   - run[n-3].length > run[n-2].length + run[n-1].length
- *   - run[n-2].length > run[n-1].length
- * Merge the pair that keeps sizes more balanced.
+ * Merge runs at stack positions idx and idx + 1.
+ */
+static void timMergeStackAt(
+    Array *array,
+    TimRun *run_stack,
+    size_t *stack_size,
+    const size_t idx,
+    const key_val_func key,
+    BdsSortContext *ctx
+) {
+    timMergeAt(array, run_stack[idx].start_idx, run_stack[idx].length, run_stack[idx + 1].length, key, ctx);
+
+    run_stack[idx].length += run_stack[idx + 1].length;
+
+    // Shift the run above the merged pair down
+    if (idx + 2 < *stack_size) run_stack[idx + 1] = run_stack[idx + 2];
+
+    (*stack_size)--;
+}
+
+/**
+ * Collapse until the TimSort invariants hold for the top runs A, B, C:
+ *   - |A| > |B| + |C|   (also checked one level further down)
+ *   - |B| > |C|
+ * On a violation B is merged with the smaller of its neighbours A and C,
+ * so a long run is never repeatedly merged with short ones.
  */
 static void timMergeCollapse(
     Array *array,
     TimRun *run_stack,
     size_t *stack_size,
-    const key_val_func key
+    const key_val_func key,
+    BdsSortContext *ctx
 ) {
     while (*stack_size > 1) {
-        const size_t n = *stack_size;
-
-        if (n >= 3) {
-            const size_t len_A = run_stack[n - 3].length;
-            const size_t len_B = run_stack[n - 2].length;
-            const size_t len_C = run_stack[n - 1].length;
-
-            if (len_A <= len_B + len_C || len_B <= len_C) {
-                if (len_A < len_C) {
-                    // Merge B and C
-                    const size_t base  = run_stack[n - 2].start_idx;
-                    const size_t l1    = run_stack[n - 2].length;
-                    const size_t l2    = run_stack[n - 1].length;
-
-                    timMergeAt(array, base, l1, l2, key);
-                    run_stack[n - 2].length = l1 + l2;
-                    (*stack_size)--; // pop C
-                } else {
-                    // Merge A and B
-                    const size_t base  = run_stack[n - 3].start_idx;
-                    const size_t l1    = run_stack[n - 3].length;
-                    const size_t l2    = run_stack[n - 2].length;
-
-                    timMergeAt(array, base, l1, l2, key);
-                    run_stack[n - 3].length = l1 + l2;
-
-                    // Shift C down
-                    run_stack[n - 2] = run_stack[n - 1];
-                    (*stack_size)--;
-                }
-            } else {
-                break;
-            }
+        size_t n = *stack_size - 2;  // B = run_stack[n], C = run_stack[n + 1]
 
-        } else {
-            // With two runs, enforce len_left > len_right
-            const size_t len_L = run_stack[n - 2].length;
-            const size_t len_R = run_stack[n - 1].length;
-
-            if (len_L <= len_R) {
-                const size_t base = run_stack[n - 2].start_idx;
-                timMergeAt(array, base, len_L, len_R, key);
-                run_stack[n - 2].length = len_L + len_R;
-                (*stack_size)--;
-            } else {
-                break;
-            }
+        if ((n > 0 && run_stack[n - 1].length <= run_stack[n].length + run_stack[n + 1].length) ||
+            (n > 1 && run_stack[n - 2].length <= run_stack[n - 1].length + run_stack[n].length)) {
+
+            // Merge A+B if A is the smaller neighbour, else B+C
+            if (run_stack[n - 1].length < run_stack[n + 1].length) n--;
+
+        } else if (run_stack[n].length > run_stack[n + 1].length) {
+            break;
         }
+
+        timMergeStackAt(array, run_stack, stack_size, n, key, ctx);
     }
 }
 
@@ -446,43 +410,15 @@ static void timMergeForceCollapse(
     Array *array,
     TimRun *run_stack,
     size_t *stack_size,
-    const key_val_func key
+    const key_val_func key,
+    BdsSortContext *ctx
 ) {
     while (*stack_size > 1) {
-        const size_t n = *stack_size;
+        size_t n = *stack_size - 2;
 
-        if (n >= 3) {
-            const size_t len_A = run_stack[n - 3].length;
-            const size_t len_C = run_stack[n - 1].length;
+        if (n > 0 && run_stack[n - 1].length < run_stack[n + 1].length) n--;
 
-            if (len_A < len_C) {
-                const size_t base = run_stack[n - 2].start_idx;
-                const size_t l1   = run_stack[n - 2].length;
-                const size_t l2   = run_stack[n - 1].length;
-
-                timMergeAt(array, base, l1, l2, key);
-                run_stack[n - 2].length = l1 + l2;
-                (*stack_size)--;
-            } else {
-                const size_t base = run_stack[n - 3].start_idx;
-                const size_t l1   = run_stack[n - 3].length;
-                const size_t l2   = run_stack[n - 2].length;
-
-                timMergeAt(array, base, l1, l2, key);
-                run_stack[n - 3].length = l1 + l2;
-                run_stack[n - 2] = run_stack[n - 1];
-                (*stack_size)--;
-            }
-        } else {
-            // Only two runs: merge them
-            const size_t base = run_stack[0].start_idx;
-            const size_t l1   = run_stack[0].length;
-            const size_t l2   = run_stack[1].length;
-
-            timMergeAt(array, base, l1, l2, key);
-            run_stack[0].length = l1 + l2;
-            (*stack_size)--;
-        }
+        timMergeStackAt(array, run_stack, stack_size, n, key, ctx);
     }
 }
 
@@ -507,10 +443,10 @@ void arrayTimSort(
             // 1) Detect a natural run (ascending or descending) starting at i
             run_len ← COUNT-RUN-AND-MAKE-ASCENDING(A, i, n, key)
 
-            // 2) If run too small, extend to minrun with insertion sort
+            // 2) If run too small, extend to minrun with a sorting network
             if run_len < minrun then
                 target ← min(minrun, remaining)
-                INSERTION-SORT-RANGE(A, i, i + target, key)     // stable
+                NETWORK-SORT-RANGE(A, i, i + target, key)       // stable, target ≤ 64
                 run_len ← target
 
             // 3) Push run on stack
@@ -527,9 +463,9 @@ void arrayTimSort(
 
 
     MINRUN(n)
-        // compute TimSort minrun (typically in [32, 64] for large n)
+        // compute TimSort minrun (in [TIM_MIN_MERGE / 2, TIM_MIN_MERGE] for large n)
         r ← 0
-        while n ≥ 64 do
+        while n ≥ TIM_MIN_MERGE do
             r ← r OR (n AND 1)
             n ← ⌊n/2⌋
         return n + r
@@ -555,48 +491,35 @@ void arrayTimSort(
 
 
     MERGE-COLLAPSE(A, stack, key)
-        // simplified TimSort invariants (as implemented):
-        // Let top runs be ... A, B, C (A below B below C):
-        //   |A| > |B| + |C|
+        // TimSort invariants. Let top runs be ... Z, A, B, C (C on top):
+        //   |A| > |B| + |C|   and   |Z| > |A| + |B|
         //   |B| > |C|
-        // If violated, merge a pair that keeps sizes balanced.
+        // If violated, merge B with the smaller of its neighbours.
         while size(stack) > 1 do
-            if size(stack) ≥ 3 then
-                lenA ← stack[n−3].len
-                lenB ← stack[n−2].len
-                lenC ← stack[n−1].len
-
-                if (lenA ≤ lenB + lenC) OR (lenB ≤ lenC) then
-                    if lenA < lenC then
-                        MERGE-AT(A, base=stack[n−2].start, left=lenB, right=lenC, key)  // merge B+C
-                        REPLACE stack[n−2] with merged run; POP stack[n−1]
-                    else
-                        MERGE-AT(A, base=stack[n−3].start, left=lenA, right=lenB, key)  // merge A+B
-                        REPLACE stack[n−3] with merged run; SHIFT stack[n−2] ← stack[n−1]; POP stack[n−1]
+            if |A| ≤ |B| + |C| or |Z| ≤ |A| + |B| then
+                if |A| < |C| then
+                    MERGE-AT(A, base=start(A), left=|A|, right=|B|, key)   // merge A+B
                 else
-                    break
+                    MERGE-AT(A, base=start(B), left=|B|, right=|C|, key)   // merge B+C
+            else if |B| ≤ |C| then
+                MERGE-AT(A, base=start(B), left=|B|, right=|C|, key)       // merge B+C
             else
-                // only 2 runs: enforce len_left > len_right, else merge
-                lenL ← stack[0].len
-                lenR ← stack[1].len
-                if lenL ≤ lenR then
-                    MERGE-AT(A, base=stack[0].start, left=lenL, right=lenR, key)
-                    REPLACE stack[0] with merged run; POP stack[1]
-                else
-                    break
+                break
+            REPLACE the merged pair with one run on the stack
 
 
     MERGE-FORCE-COLLAPSE(A, stack, key)
         while size(stack) > 1 do
-            // merge adjacent runs until one remains (choosing to balance sizes)
-            choose adjacent pair (per implementation) and MERGE-AT(...)
+            if |A| < |C| then merge A+B else merge B+C
 
 
     MERGE-AT(A, base, left_len, right_len, key)
         // left run:  [base, base + left_len)
         // right run: [base + left_len, base + left_len + right_len)
         // stable merge using a buffer for the left run and "galloping" block copies:
-        //   - allocate left_buf[left_len]
+        //   - left_buf ← WORKSPACE-BUFFER(left_len)   // grows, never shrinks; reused
+        //                                            // by every merge and, via
+        //                                            // arrayTimSortCtx, every call
         //   - standard merge
         //   - when one side wins repeatedly, gallop (exponential + binary search)
         //     to copy a whole block at once
@@ -608,7 +531,7 @@ void arrayTimSort(
 
        TimSort is adaptive:
          - Detecting runs is linear: Θ(n) comparisons in total across the scan.
-         - Extending short runs uses insertion sort on small ranges (≤ minrun),
+         - Extending short runs uses a sorting network on small ranges (≤ minrun ≤ 64),
            which keeps overhead bounded and helps on partially-sorted data.
          - Merging runs dominates, like merge sort.
 
@@ -636,9 +559,11 @@ void arrayTimSort(
        m(n) = n
 
        Peak auxiliary memory is dominated by merge buffering:
-         - MERGE-AT allocates a temporary buffer for the left run:
+         - MERGE-AT buffers the left run in the sort workspace:
              left_buf[left_len]  (pointers)
            In the worst case, left_len can be Θ(n), so peak extra memory is Θ(n).
+           The buffer only grows, so a call performs at most O(log n) allocations
+           (none at all with a warmed-up BdsSortContext).
 
        Other memory:
          - run_stack is a fixed-size array (TIM_STACK_MAX) ⇒ Θ(1)
@@ -663,6 +588,18 @@ void arrayTimSort(
     Array *array,
     const key_val_func key
 ) {
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayTimSortCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayTimSortCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayTimSort(array, key);
+        return;
+    }
+
     const size_t total_len = arrayLength(array);
     if (total_len < 2) return;
 
@@ -678,10 +615,10 @@ void arrayTimSort(
         // 1) Detect natural run and normalize to ascending
         size_t run_len = timCountRunAndMakeAscending(array, curr_idx, total_len, key);
 
-        // 2) Extend to minrun using insertion sort
+        // 2) Extend to minrun using a sorting network (stable, one key() per element)
         if (run_len < minrun_len) {
             const size_t target_len = minrun_len < remaining ? minrun_len : remaining;
-            timInsertionSortRange(array, curr_idx, curr_idx + target_len, key);
+            sortNetworkSortRange(array, curr_idx, curr_idx + target_len, key);
             run_len = target_len;
         }
 
@@ -691,14 +628,14 @@ void arrayTimSort(
         stack_size++;
 
         // 4) Collapse while invariants are violated
-        timMergeCollapse(array, run_stack, &stack_size, key);
+        timMergeCollapse(array, run_stack, &stack_size, key, ctx);
 
         curr_idx  += run_len;
         remaining -= run_len;
     }
 
     // 5) Final collapse
-    timMergeForceCollapse(array, run_stack, &stack_size, key);
+    timMergeForceCollapse(array, run_stack, &stack_size, key, ctx);
 }
 
 Array *arrayTimSorted(
@@ -711,3 +648,292 @@ Array *arrayTimSorted(
     arrayTimSort(sorted, key);
     return sorted;
 }
+
+/// ===============================================================
+/// Keyed TimSort (operates on a key cache, no key() calls)
+/// ===============================================================
+
+/**
+ * Same run detection as timCountRunAndMakeAscending(), on cached keys.
+ */
+static size_t keyedTimCountRunAndMakeAscending(
+    KeyedItem *items,
+    const size_t run_start_idx,
+    const size_t length
+) {
+    if (run_start_idx >= length - 1) return 1;
+
+    size_t run_end_idx = run_start_idx + 1;
+
+    if (KEYED_CMP(items[run_end_idx].key < items[run_start_idx].key)) {
+        while (run_end_idx + 1 < length && KEYED_CMP(items[run_end_idx + 1].key < items[run_end_idx].key)) {
+            run_end_idx++;
+        }
+
+        for (size_t i = run_start_idx, j = run_end_idx; i < j; i++, j--) {
+            BDS_STATS_ADD(swaps, 1);
+            const KeyedItem temp = items[i];
+            items[i] = items[j];
+            items[j] = temp;
+        }
+
+    } else {
+        while (run_end_idx + 1 < length && KEYED_CMP(items[run_end_idx + 1].key >= items[run_end_idx].key)) {
+            run_end_idx++;
+        }
+    }
+
+    return run_end_idx - run_start_idx + 1;
+}
+
+// Count of leading elements with key <= target
+static size_t keyedCountLessEqual(const KeyedItem *items, const size_t length, const int target) {
+    size_t left = 0, right = length;
+
+    while (left < right) {
+        const size_t mid = left + ((right - left) >> 1);
+
+        if (KEYED_CMP(items[mid].key <= target)) left = mid + 1;
+        else right = mid;
+    }
+
+    return left;
+}
+
+// Count of leading elements with key < target
+static size_t keyedCountLess(const KeyedItem *items, const size_t length, const int target) {
+    size_t left = 0, right = length;
+
+    while (left < right) {
+        const size_t mid = left + ((right - left) >> 1);
+
+        if (KEYED_CMP(items[mid].key < target)) left = mid + 1;
+        else right = mid;
+    }
+
+    return left;
+}
+
+/**
+ * Merge adjacent runs [base, base + left_len) and [base + left_len, ... + right_len).
+ * Elements already in their final place are trimmed with binary searches, then
+ * the shorter side is copied into `scratch` (capacity >= min(left_len, right_len)).
+ */
+static void keyedTimMergeAt(
+    KeyedItem *items,
+    KeyedItem *scratch,
+    size_t base,
+    size_t left_len,
+    size_t right_len
+) {
+    // Left prefix <= first right key is already in place
+    const size_t skip = keyedCountLessEqual(&items[base], left_len, items[base + left_len].key);
+    base     += skip;
+    left_len -= skip;
+    if (left_len == 0) return;
+
+    // Right suffix >= last left key is already in place
+    const size_t right_base = base + left_len;
+    right_len = keyedCountLess(&items[right_base], right_len, items[right_base - 1].key);
+    if (right_len == 0) return;
+
+    BDS_STATS_ADD(writes, left_len + right_len);  // Every untrimmed item is stored back once
+
+    if (left_len <= right_len) {
+        // Merge low: buffer the left run, fill from the front
+        memcpy(scratch, &items[base], left_len * sizeof(KeyedItem));
+
+        size_t left_idx  = 0;
+        size_t right_idx = right_base;
+        size_t write_idx = base;
+
+        const size_t right_end = right_base + right_len;
+
+        while (left_idx < left_len && right_idx < right_end) {
+            if (KEYED_CMP(items[right_idx].key < scratch[left_idx].key)) {
+                items[write_idx++] = items[right_idx++];
+            } else {
+                items[write_idx++] = scratch[left_idx++];  // Stable: left wins ties
+            }
+        }
+
+        memcpy(&items[write_idx], &scratch[left_idx], (left_len - left_idx) * sizeof(KeyedItem));
+
+    } else {
+        // Merge high: buffer the right run, fill from the back
+        memcpy(scratch, &items[right_base], right_len * sizeof(KeyedItem));
+
+        size_t left_rem  = left_len;   // items[base, base + left_rem) still unmerged
+        size_t right_rem = right_len;  // scratch[0, right_rem) still unmerged
+        size_t write_end = right_base + right_len;
+
+        while (left_rem > 0 && right_rem > 0) {
+            if (KEYED_CMP(items[base + left_rem - 1].key > scratch[right_rem - 1].key)) {
+                items[--write_end] = items[base + --left_rem];
+            } else {
+                items[--write_end] = scratch[--right_rem];  // Stable: right wins ties at the back
+            }
+        }
+
+        memcpy(&items[base], scratch, right_rem * sizeof(KeyedItem));
+    }
+}
+
+/**
+ * Merge runs at stack positions idx and idx + 1.
+ */
+static void keyedTimMergeStackAt(
+    KeyedItem *items,
+    KeyedItem *scratch,
+    TimRun *run_stack,
+    size_t *stack_size,
+    const size_t idx
+) {
+    keyedTimMergeAt(
+        items,
+        scratch,
+        run_stack[idx].start_idx,
+        run_stack[idx].length,
+        run_stack[idx + 1].length
+    );
+
+    run_stack[idx].length += run_stack[idx + 1].length;
+
+    if (idx + 2 < *stack_size) run_stack[idx + 1] = run_stack[idx + 2];
+
+    (*stack_size)--;
+}
+
+/**
+ * Collapse until the full TimSort invariants hold for the top 4 runs:
+ *   |R(n-3)| > |R(n-2)| + |R(n-1)|,  |R(n-2)| > |R(n-1)|
+ */
+static void keyedTimMergeCollapse(
+    KeyedItem *items,
+    KeyedItem *scratch,
+    TimRun *run_stack,
+    size_t *stack_size
+) {
+    while (*stack_size > 1) {
+        size_t n = *stack_size - 2;
+
+        if ((n > 0 && run_stack[n - 1].length <= run_stack[n].length + run_stack[n + 1].length) ||
+            (n > 1 && run_stack[n - 2].length <= run_stack[n - 1].length + run_stack[n].length)) {
+
+            if (run_stack[n - 1].length < run_stack[n + 1].length) n--;
+
+        } else if (run_stack[n].length > run_stack[n + 1].length) {
+            break;
+        }
+
+        keyedTimMergeStackAt(items, scratch, run_stack, stack_size, n);
+    }
+}
+
+static void keyedTimMergeForceCollapse(
+    KeyedItem *items,
+    KeyedItem *scratch,
+    TimRun *run_stack,
+    size_t *stack_size
+) {
+    while (*stack_size > 1) {
+        size_t n = *stack_size - 2;
+
+        if (n > 0 && run_stack[n - 1].length < run_stack[n + 1].length) n--;
+
+        keyedTimMergeStackAt(items, scratch, run_stack, stack_size, n);
+    }
+}
+
+void keyedTimSortWith(KeyedItem *items, KeyedItem *scratch, const size_t length) {
+    if (length < 2) return;
+
+    const size_t minrun_len = timMinRun(length);
+
+    TimRun run_stack[TIM_STACK_MAX];
+    size_t stack_size = 0;
+
+    size_t curr_idx = 0;
+
+    while (curr_idx < length) {
+        const size_t remaining = length - curr_idx;
+
+        size_t run_len = keyedTimCountRunAndMakeAscending(items, curr_idx, length);
+
+        if (run_len < minrun_len) {
+            const size_t target_len = minrun_len < remaining ? minrun_len : remaining;
+            keyedNetworkSort(items + curr_idx, target_len);
+            run_len = target_len;
+        }
+
+        run_stack[stack_size].start_idx = curr_idx;
+        run_stack[stack_size].length    = run_len;
+        stack_size++;
+
+        keyedTimMergeCollapse(items, scratch, run_stack, &stack_size);
+
+        curr_idx += run_len;
+    }
+
+    keyedTimMergeForceCollapse(items, scratch, run_stack, &stack_size);
+}
+
+bool keyedTimSort(KeyedItem *items, const size_t length) {
+    if (length < 2) return true;
+
+    KeyedItem *scratch = (KeyedItem *)malloc(KEYED_TIM_SCRATCH_LENGTH(length) * sizeof(KeyedItem));
+    if (!scratch) return false;
+
+    keyedTimSortWith(items, scratch, length);
+
+    free(scratch);
+    return true;
+}
+
+void arrayTimSortCached(Array *array, const key_val_func key) {
+    /*
+    TIMSORT-CACHED(A, key)
+        C ← [(key(A[i]), A[i]) for i ← 0 to n − 1]   // n key() calls
+        TIMSORT(C, λc. c.key)                         // stable, integer compares only
+        for i ← 0 to n − 1 do
+            A[i] ← C[i].ptr
+    */
+
+    /* Time:   𝒪[n log n] compares (𝒪[n] on presorted input), exactly n key() calls.
+       Memory: m(n) = n pairs + n/2 merge buffer ⇒ 𝒪[n]
+    */
+
+    BdsSortContext ctx = SORT_CONTEXT_EMPTY;
+
+    arrayTimSortCachedCtx(array, key, &ctx);
+    sortContextRelease(&ctx);
+}
+
+void arrayTimSortCachedCtx(Array *array, const key_val_func key, BdsSortContext *ctx) {
+    if (!ctx) {
+        arrayTimSortCached(array, key);
+        return;
+    }
+
+    const size_t length = arrayLength(array);
+    if (length < 2) return;
+
+    // No room for the cache: the Array-level TimSort is stable too (key() per comparison)
+    KeyedItem *scratch = sortContextScratch(ctx, KEYED_TIM_SCRATCH_LENGTH(length));
+    KeyedItem *items = scratch ? sortContextKeyCache(ctx, array, key) : NULL;
+    if (!items) {
+        arrayTimSort(array, key);
+        return;
+    }
+
+    keyedTimSortWith(items, scratch, length);
+    keyCacheWriteBack(array, items);
+}
+
+Array *arrayTimSortedCached(const Array *array, const key_val_func key) {
+    Array *sorted = arrayShallowCopy(array);
+    if (!sorted) return NULL;
+
+    arrayTimSortCached(sorted, key);
+    return sorted;
+}
@@ -87,6 +87,7 @@ static MaxHeap *maxHeapTailToHead(MaxHeap *max_heap) {
     // NOTE: NOTE: UNNECESSARY STEP, BUT KEEPS THE MEMORY CLEAN
     max_heap->data[max_heap->length] = NULL;
 
+    BDS_STATS_ADD(allocs, 1);
     void **reallocated_heap_data_array = realloc(max_heap->data, max_heap->length * sizeof *max_heap->data);
     // NOTE: IT SHOULD BE FINE ANYWAY. IT'LL JUST GROW A BIT
     if (reallocated_heap_data_array) max_heap->data = reallocated_heap_data_array;
@@ -117,6 +118,7 @@ bool maxHeapAdd(MaxHeap *max_heap, void *data, const key_val_func key) {
     const size_t old_len = maxHeapLength(max_heap);
     const size_t new_len = old_len + 1;
 
+    BDS_STATS_ADD(allocs, 1);
     void **new_data = realloc(max_heap->data, new_len * sizeof *max_heap->data);
     if (!new_data) return false;
 
@@ -89,6 +89,7 @@ static MinHeap *minHeapTailToHead(MinHeap *min_Heap) {
     // NOTE: NOTE: UNNECESSARY STEP, BUT KEEPS THE MEMORY CLEAN
     min_Heap->data[min_Heap->length] = NULL;
 
+    BDS_STATS_ADD(allocs, 1);
     void **reallocated_heap_data_array = realloc(min_Heap->data, min_Heap->length * sizeof *min_Heap->data);
     // NOTE: IT SHOULD BE FINE ANYWAY. IT'LL JUST GROW A BIT
     if (reallocated_heap_data_array) min_Heap->data = reallocated_heap_data_array;
@@ -120,6 +121,7 @@ bool minHeapAdd(MinHeap *min_heap, void *data, const key_val_func key) {
     const size_t old_len = minHeapLength(min_heap);
     const size_t new_len = old_len + 1;
 
+    BDS_STATS_ADD(allocs, 1);
     void **new_data = realloc(min_heap->data, new_len * sizeof *min_heap->data);
     if (!new_data) return false;
 
@@ -1,2 +1,8 @@
 #pragma once
 
+// Read prefetch hint with low temporal locality; a no-op where unsupported
+#if defined(__GNUC__) || defined(__clang__)
+#define BDS_PREFETCH(addr) __builtin_prefetch((addr), 0, 1)
+#else
+#define BDS_PREFETCH(addr) ((void)(addr))
+#endif
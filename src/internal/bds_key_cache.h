@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../../include/bds/array/bds_array_core.h"
+#include "bds_internal.h"
+
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+
+/// ===============================================================
+/// Key cache (decorate-sort-undecorate)
+/// ===============================================================
+///
+/// Each element's key is extracted exactly once into a contiguous
+/// buffer of (key, payload) pairs. The keyed engines below then sort
+/// that compact buffer with plain integer comparisons and the
+/// payload pointers are written back into Array->data.
+/// ===============================================================
+
+typedef struct bds_keyed_item {
+    int key;
+    void *ptr;
+} KeyedItem;
+
+// A comparison of two cached keys, counted as one compare under BDS_STATS
+// (cached keys bypass arrayKeyCompare, which counts the Array paths)
+#define KEYED_CMP(cond) (BDS_STATS_ADD(compares, 1), (cond))
+
+// How many elements ahead of the current one the payload is prefetched
+#define KEY_CACHE_PREFETCH_DISTANCE 8
+
+//// Lifecycle ////
+
+// Fills items[i] = { key(array[i]), array[i] }; calls `key` exactly length times
+void keyCacheFill(KeyedItem *items, const Array *array, key_val_func key);
+
+KeyedItem *keyCacheNew(const Array *array, key_val_func key);  // malloc + fill; NULL on OOM or empty
+
+void keyCacheWriteBack(Array *array, const KeyedItem *items);  // array[i] = items[i].ptr
+
+//// Keyed engines (operate on the cached buffer only) ////
+
+void keyedInsertionSort(KeyedItem *items, size_t length);  // Stable
+
+void keyedIntroSort(KeyedItem *items, size_t length);  // Not stable, in-place
+
+// IntroSort building blocks, for engines that drive the recursion themselves
+size_t keyedIntroDepthLimit(size_t length);  // 2·⌊log2 n⌋
+// Median-of-three 3-way partition; needs hi − lo ≥ 3.
+// Leaves [lo, *eq_lo) < pivot, [*eq_lo, *eq_hi) == pivot, [*eq_hi, hi) > pivot.
+void keyedIntroPartition(KeyedItem *items, size_t lo, size_t hi, size_t *eq_lo, size_t *eq_hi);
+void keyedIntroSortRange(KeyedItem *items, size_t lo, size_t hi, size_t depth_limit);
+void keyedHeapSortRange(KeyedItem *items, size_t lo, size_t hi);
+
+void keyedPdqSort(KeyedItem *items, size_t length);  // Not stable, in-place
+
+void keyedMergeSort(KeyedItem *items, KeyedItem *scratch, size_t length);  // Stable; scratch holds length items
+
+bool keyedTimSort(KeyedItem *items, size_t length);  // Stable; false on OOM (items left untouched)
+
+// The shorter side of any TimSort merge is at most length / 2
+#define KEYED_TIM_SCRATCH_LENGTH(length) (((length) >> 1) + 1)
+void keyedTimSortWith(KeyedItem *items, KeyedItem *scratch, size_t length);  // scratch holds KEYED_TIM_SCRATCH_LENGTH
+
+// Stable; scratch holds length items. Writes the sorted payloads to out[0, length)
+// (may be the Array the keys came from); items and scratch are left clobbered.
+void keyedRadixSort(KeyedItem *items, KeyedItem *scratch, size_t length, void **out);
@@ -0,0 +1,143 @@
+/// Worker teams on top of pthreads
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bds_parallel.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>  // sysconf
+
+struct bds_parallel_team {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+
+    // Barrier state
+    size_t waiting;
+    size_t generation;
+
+    // Start gate: workers only run the task once every thread exists
+    bool go;
+    bool abort;
+
+    parallel_task_func task;
+    void *ctx;
+};
+
+typedef struct bds_parallel_slot {
+    ParallelWorker worker;
+    pthread_t thread;
+} ParallelSlot;
+
+size_t parallelThreadCount(const size_t requested) {
+    if (requested > 0) return requested;
+
+    const long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (size_t)online : 1u;
+}
+
+size_t parallelTeamSize(const size_t length, const size_t threads, const size_t min_chunk) {
+    const size_t by_length = min_chunk > 0 ? length / min_chunk : length;
+    const size_t team_size = threads < by_length ? threads : by_length;
+
+    return team_size > 0 ? team_size : 1u;
+}
+
+static void *parallelWorkerMain(void *arg) {
+    const ParallelWorker *worker = (const ParallelWorker *)arg;
+    struct bds_parallel_team *team = worker->team;
+
+    pthread_mutex_lock(&team->lock);
+    while (!team->go && !team->abort) {
+        pthread_cond_wait(&team->cond, &team->lock);
+    }
+    const bool aborted = team->abort;
+    pthread_mutex_unlock(&team->lock);
+
+    if (!aborted) team->task(team->ctx, worker);
+
+    return NULL;
+}
+
+static void parallelRunSolo(const parallel_task_func task, void *ctx) {
+    const ParallelWorker solo = { 0, 1, NULL };
+    task(ctx, &solo);
+}
+
+void parallelRun(const size_t worker_count, const parallel_task_func task, void *ctx) {
+    if (worker_count <= 1) {
+        parallelRunSolo(task, ctx);
+        return;
+    }
+
+    ParallelSlot *slots = (ParallelSlot *)malloc(worker_count * sizeof(ParallelSlot));
+    if (!slots) {
+        parallelRunSolo(task, ctx);
+        return;
+    }
+
+    struct bds_parallel_team team;
+    pthread_mutex_init(&team.lock, NULL);
+    pthread_cond_init(&team.cond, NULL);
+    team.waiting    = 0;
+    team.generation = 0;
+    team.go         = false;
+    team.abort      = false;
+    team.task       = task;
+    team.ctx        = ctx;
+
+    for (size_t i = 0; i < worker_count; i++) {
+        slots[i].worker.idx   = i;
+        slots[i].worker.count = worker_count;
+        slots[i].worker.team  = &team;
+    }
+
+    size_t started = 1;  // slot 0 is the calling thread
+
+    while (started < worker_count) {
+        if (pthread_create(&slots[started].thread, NULL, parallelWorkerMain, &slots[started].worker) != 0) break;
+        started++;
+    }
+
+    pthread_mutex_lock(&team.lock);
+    if (started == worker_count) team.go = true;
+    else team.abort = true;
+    pthread_cond_broadcast(&team.cond);
+    pthread_mutex_unlock(&team.lock);
+
+    if (started == worker_count) task(ctx, &slots[0].worker);
+
+    for (size_t i = 1; i < started; i++) {
+        pthread_join(slots[i].thread, NULL);
+    }
+
+    // Could not build the full team: fall back to the calling thread alone
+    if (started != worker_count) parallelRunSolo(task, ctx);
+
+    pthread_cond_destroy(&team.cond);
+    pthread_mutex_destroy(&team.lock);
+    free(slots);
+}
+
+void parallelSync(const ParallelWorker *worker) {
+    if (worker->count <= 1) return;
+
+    struct bds_parallel_team *team = worker->team;
+
+    pthread_mutex_lock(&team->lock);
+
+    const size_t generation = team->generation;
+
+    if (++team->waiting == worker->count) {
+        team->waiting = 0;
+        team->generation++;
+        pthread_cond_broadcast(&team->cond);
+
+    } else {
+        while (generation == team->generation) {
+            pthread_cond_wait(&team->cond, &team->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&team->lock);
+}
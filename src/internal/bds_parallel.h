@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+
+/// ===============================================================
+/// Worker teams (pthreads)
+/// ===============================================================
+///
+/// parallelRun() starts a team of workers that all execute the same
+/// task; the calling thread is worker 0. Workers split the data by
+/// their index and meet at parallelSync() between phases.
+///
+/// If threads cannot be created the task runs on a team of one, so
+/// tasks must only rely on worker->count, never on the requested size.
+/// ===============================================================
+
+struct bds_parallel_team;
+
+typedef struct bds_parallel_worker {
+    size_t idx;     // 0 .. count-1
+    size_t count;   // team size
+    struct bds_parallel_team *team;
+} ParallelWorker;
+
+typedef void (*parallel_task_func)(void *ctx, const ParallelWorker *worker);
+
+// requested == 0 → number of online CPUs. Always >= 1.
+size_t parallelThreadCount(size_t requested);
+
+// Caps `threads` so that each worker gets at least `min_chunk` elements. Always >= 1.
+size_t parallelTeamSize(size_t length, size_t threads, size_t min_chunk);
+
+void parallelRun(size_t worker_count, parallel_task_func task, void *ctx);
+
+void parallelSync(const ParallelWorker *worker);  // Barrier across the whole team
+
+// Start of part `idx` when [0, length) is split evenly in `count` parts (idx == count → length)
+static inline size_t parallelSplitAt(const size_t length, const size_t count, const size_t idx) {
+    const size_t base  = length / count;
+    const size_t extra = length % count;  // first `extra` parts take one more
+
+    return idx * base + (idx < extra ? idx : extra);
+}
+
+// Even split of [0, length) → this worker's [*lo, *hi)
+static inline void parallelSplit(
+    const size_t length,
+    const ParallelWorker *worker,
+    size_t *lo,
+    size_t *hi
+) {
+    *lo = parallelSplitAt(length, worker->count, worker->idx);
+    *hi = parallelSplitAt(length, worker->count, worker->idx + 1);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../../include/bds/array/bds_array_sort.h"
+#include "bds_key_cache.h"
+
+#include <stddef.h>  // size_t
+
+/// ===============================================================
+/// Sort workspace internals
+/// ===============================================================
+///
+/// Each buffer only ever grows. The getters return a buffer with room
+/// for at least `count` elements, reallocating only when the current
+/// one is too small, so repeated sorts of similar sizes allocate
+/// nothing. Buffer contents are not preserved across growth.
+///
+/// Sorts without a caller-provided context run on a stack-local
+/// SORT_CONTEXT_EMPTY workspace and sortContextRelease() it on exit.
+/// ===============================================================
+
+struct bds_sort_context {
+    void **pointers;       // Array merge buffers (merge sort, TimSort)
+    size_t pointer_capacity;
+
+    KeyedItem *items;      // key cache
+    size_t item_capacity;
+
+    KeyedItem *scratch;    // keyed merge / radix / TimSort buffer
+    size_t scratch_capacity;
+};
+
+#define SORT_CONTEXT_EMPTY { NULL, 0, NULL, 0, NULL, 0 }
+
+// NULL on OOM (the old buffer is kept)
+void **sortContextPointers(BdsSortContext *ctx, size_t count);
+KeyedItem *sortContextItems(BdsSortContext *ctx, size_t count);
+KeyedItem *sortContextScratch(BdsSortContext *ctx, size_t count);
+
+// Key cache in the context's item buffer; NULL on OOM
+KeyedItem *sortContextKeyCache(BdsSortContext *ctx, const Array *array, key_val_func key);
+
+void sortContextRelease(BdsSortContext *ctx);  // Frees the buffers, keeps the struct usable
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../../include/bds/array/bds_array_core.h"
+
+#include <stddef.h>  // size_t
+
+/// ===============================================================
+/// In-place Array kernels shared by the sorts and selection
+/// ===============================================================
+///
+/// All ranges are half-open, [lo, hi). These work directly on the
+/// Array and call key() as they go; see bds_key_cache.h for the
+/// cached (KeyedItem) counterparts. Library-internal: the sortKernel
+/// prefix keeps them apart from the public array* API.
+/// ===============================================================
+
+//// Partitioning (array_quick_sort.c) ////
+
+// Orders (lo, mid, hi-1) by key and returns mid; needs hi − lo ≥ 3
+size_t sortKernelMedianOfThree(Array *array, size_t lo, size_t hi, key_val_func key);
+
+// 3-way partition around key(array[pivot_idx]), pivot_idx in [lo, hi).
+// Leaves [lo, *eq_lo) < pivot, [*eq_lo, *eq_hi) == pivot, [*eq_hi, hi) > pivot.
+void sortKernelPartitionAround(
+    Array *array, size_t lo, size_t hi, size_t pivot_idx, key_val_func key,
+    size_t *eq_lo, size_t *eq_hi
+);
+
+//// Heap (max-heap rooted at heap_lo) and IntroSort (array_intro_sort.c) ////
+
+void sortKernelHeapSiftDown(Array *array, size_t root, size_t heap_lo, size_t heap_hi, key_val_func key);
+void sortKernelHeapSortRange(Array *array, size_t lo, size_t hi, key_val_func key);
+
+size_t sortKernelIntroDepthLimit(size_t length);  // 2·⌊log2 n⌋
+void sortKernelIntroSortRange(Array *array, size_t lo, size_t hi, key_val_func key);
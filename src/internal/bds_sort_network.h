@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../../include/bds/array/bds_array_core.h"
+#include "bds_key_cache.h"
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint64_t
+
+/// ===============================================================
+/// Sorting-network leaf kernel
+/// ===============================================================
+///
+/// Small ranges are sorted by fixed comparator networks instead of
+/// insertion sort: the sequence of compare-exchanges does not depend
+/// on the data, and every compare-exchange is a branchless min/max,
+/// so there is nothing to mispredict.
+///
+/// The network sorts 64-bit *ranks*, (biased key << 32) | position,
+/// and the payloads are gathered afterwards. Ranks are unique, so the
+/// kernel is stable and moves 8 bytes per exchange instead of a
+/// (key, ptr) pair.
+/// ===============================================================
+
+#define SORT_NETWORK_MAX_LENGTH 64  // ≥ TimSort's largest minrun
+
+// Sorts ranks[0, length); length <= SORT_NETWORK_MAX_LENGTH
+void sortNetworkRanks(uint64_t *ranks, size_t length);
+
+// Stable; length <= SORT_NETWORK_MAX_LENGTH
+void keyedNetworkSort(KeyedItem *items, size_t length);
+
+// Stable; calls key() exactly once per element; hi − lo <= SORT_NETWORK_MAX_LENGTH
+void sortNetworkSortRange(Array *array, size_t lo, size_t hi, key_val_func key);
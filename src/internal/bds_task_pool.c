@@ -0,0 +1,238 @@
+/// Work-stealing task pool (Chase-Lev deques, C11 atomics)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bds_task_pool.h"
+#include "bds_parallel.h"
+
+#include <sched.h>  // sched_yield
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#define TASK_POOL_DEQUE_MASK (TASK_POOL_DEQUE_CAPACITY - 1)
+
+// Slots hold indexes into pool->tasks, so every slot access is a plain atomic word.
+typedef struct bds_task_deque {
+    atomic_ptrdiff_t top;     // thieves take here (oldest task)
+    atomic_ptrdiff_t bottom;  // owner pushes/pops here (newest task)
+    atomic_size_t slots[TASK_POOL_DEQUE_CAPACITY];
+} TaskDeque;
+
+struct bds_task_pool {
+    TaskDeque *deques;
+    size_t deque_count;
+
+    RangeTask *tasks;         // task arena; a task is written once, before it is pushed
+    size_t task_capacity;
+    atomic_size_t next_task;
+
+    atomic_size_t pending;    // pushed but not finished
+
+    range_task_func run;
+    void *ctx;
+};
+
+/// ===============================================================
+/// Chase-Lev deque (Lê, Pop, Cohen, Zappa Nardelli, PPoPP'13)
+/// ===============================================================
+
+static void dequeInit(TaskDeque *deque) {
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+
+    for (size_t i = 0; i < TASK_POOL_DEQUE_CAPACITY; i++) {
+        atomic_init(&deque->slots[i], 0);
+    }
+}
+
+// Owner only. Returns false when the deque is full.
+static bool dequePush(TaskDeque *deque, const size_t task_idx) {
+    const ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    const ptrdiff_t top    = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    if (bottom - top >= TASK_POOL_DEQUE_CAPACITY) return false;
+
+    atomic_store_explicit(&deque->slots[bottom & TASK_POOL_DEQUE_MASK], task_idx, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);  // publishes the task
+
+    return true;
+}
+
+// Owner only. Pops the newest task.
+static bool dequeTake(TaskDeque *deque, size_t *task_idx) {
+    const ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        // Empty
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *task_idx = atomic_load_explicit(&deque->slots[bottom & TASK_POOL_DEQUE_MASK], memory_order_relaxed);
+
+    if (top == bottom) {
+        // Last task: race against thieves for it
+        const bool won = atomic_compare_exchange_strong_explicit(
+            &deque->top, &top, top + 1,
+            memory_order_seq_cst, memory_order_relaxed
+        );
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return won;
+    }
+
+    return true;
+}
+
+// Any thread. Takes the oldest task.
+static bool dequeSteal(TaskDeque *deque, size_t *task_idx) {
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom) return false;
+
+    *task_idx = atomic_load_explicit(&deque->slots[top & TASK_POOL_DEQUE_MASK], memory_order_relaxed);
+
+    return atomic_compare_exchange_strong_explicit(
+        &deque->top, &top, top + 1,
+        memory_order_seq_cst, memory_order_relaxed
+    );
+}
+
+/// ===============================================================
+/// Workers
+/// ===============================================================
+
+static bool taskPoolStealAny(TaskPoolWorker *worker, size_t *task_idx) {
+    TaskPool *pool = worker->pool;
+
+    // xorshift32 for the first victim, then sweep the rest
+    unsigned int state = worker->rng_state;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    worker->rng_state = state;
+
+    const size_t first = state % pool->deque_count;
+
+    for (size_t k = 0; k < pool->deque_count; k++) {
+        const size_t victim = (first + k) % pool->deque_count;
+        if (victim == worker->idx) continue;
+
+        if (dequeSteal(&pool->deques[victim], task_idx)) return true;
+    }
+
+    return false;
+}
+
+static void taskPoolWorkerMain(void *arg, const ParallelWorker *team_worker) {
+    TaskPool *pool = (TaskPool *)arg;
+
+    TaskPoolWorker worker;
+    worker.pool      = pool;
+    worker.idx       = team_worker->idx;
+    worker.rng_state = 2463534242u + (unsigned int)team_worker->idx * 7919u;
+
+    TaskDeque *own = &pool->deques[worker.idx];
+
+    while (1) {
+        size_t task_idx;
+
+        if (dequeTake(own, &task_idx) || taskPoolStealAny(&worker, &task_idx)) {
+            pool->run(pool->ctx, &worker, pool->tasks[task_idx]);
+            atomic_fetch_sub(&pool->pending, 1);
+            continue;
+        }
+
+        if (atomic_load(&pool->pending) == 0) break;
+
+        sched_yield();
+    }
+}
+
+void taskPoolSpawn(TaskPoolWorker *worker, const RangeTask task) {
+    TaskPool *pool = worker->pool;
+
+    const size_t task_idx = atomic_fetch_add(&pool->next_task, 1);
+
+    if (task_idx < pool->task_capacity) {
+        pool->tasks[task_idx] = task;
+        atomic_fetch_add(&pool->pending, 1);
+
+        if (dequePush(&pool->deques[worker->idx], task_idx)) return;
+
+        atomic_fetch_sub(&pool->pending, 1);
+    }
+
+    // Arena exhausted or deque full: just do it now
+    pool->run(pool->ctx, worker, task);
+}
+
+/// ===============================================================
+/// Public
+/// ===============================================================
+
+void taskPoolRun(
+    const size_t worker_count,
+    const size_t max_tasks,
+    const range_task_func run,
+    void *ctx,
+    const RangeTask *roots,
+    const size_t root_count
+) {
+    const size_t deque_count = worker_count > 0 ? worker_count : 1u;
+
+    TaskPool pool;
+    pool.deque_count   = deque_count;
+    pool.task_capacity = root_count + max_tasks;
+    pool.run           = run;
+    pool.ctx           = ctx;
+    pool.deques        = (TaskDeque *)malloc(deque_count * sizeof(TaskDeque));
+    pool.tasks         = (RangeTask *)malloc(pool.task_capacity * sizeof(RangeTask));
+
+    if (!pool.deques || !pool.tasks) {
+        free(pool.deques);
+        free(pool.tasks);
+
+        // No pool: an empty arena makes every spawn run inline (plain serial recursion)
+        pool.deques        = NULL;
+        pool.tasks         = NULL;
+        pool.task_capacity = 0;
+        atomic_init(&pool.next_task, 0);
+
+        TaskPoolWorker solo = { &pool, 0, 1u };
+
+        for (size_t i = 0; i < root_count; i++) {
+            run(ctx, &solo, roots[i]);
+        }
+
+        return;
+    }
+
+    for (size_t i = 0; i < deque_count; i++) {
+        dequeInit(&pool.deques[i]);
+    }
+
+    atomic_init(&pool.next_task, root_count);
+    atomic_init(&pool.pending, 0);
+
+    // Deal the roots round-robin; a root that does not fit runs right away
+    for (size_t i = 0; i < root_count; i++) {
+        pool.tasks[i] = roots[i];
+        atomic_fetch_add(&pool.pending, 1);
+
+        if (!dequePush(&pool.deques[i % deque_count], i)) {
+            TaskPoolWorker solo = { &pool, i % deque_count, 1u };
+            atomic_fetch_sub(&pool.pending, 1);
+            run(ctx, &solo, roots[i]);
+        }
+    }
+
+    parallelRun(deque_count, taskPoolWorkerMain, &pool);
+
+    free(pool.tasks);
+    free(pool.deques);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+
+/// ===============================================================
+/// Work-stealing task pool over index ranges
+/// ===============================================================
+///
+/// Every worker owns a Chase-Lev deque. A worker pushes and pops its
+/// own tasks at the bottom (LIFO, cache-warm); idle workers steal the
+/// oldest (largest) task from the top of a random victim's deque.
+///
+/// Tasks are (lo, hi, depth) triples handled by a single run function,
+/// which may spawn more tasks. taskPoolRun() returns once every task,
+/// including the spawned ones, has finished.
+/// ===============================================================
+
+typedef struct bds_range_task {
+    size_t lo;
+    size_t hi;
+    size_t depth;
+} RangeTask;
+
+typedef struct bds_task_pool TaskPool;
+
+typedef struct bds_task_pool_worker {
+    TaskPool *pool;
+    size_t idx;
+    unsigned int rng_state;  // victim selection
+} TaskPoolWorker;
+
+typedef void (*range_task_func)(void *ctx, TaskPoolWorker *worker, RangeTask task);
+
+#define TASK_POOL_DEQUE_CAPACITY 1024  // per worker, power of two
+
+/**
+ * Runs `roots` (spread over the workers) and everything they spawn.
+ * `max_tasks` bounds the total number of spawned tasks; once it is
+ * reached, or a deque is full, spawns run inline instead.
+ */
+void taskPoolRun(
+    size_t worker_count,
+    size_t max_tasks,
+    range_task_func run,
+    void *ctx,
+    const RangeTask *roots,
+    size_t root_count
+);
+
+void taskPoolSpawn(TaskPoolWorker *worker, RangeTask task);
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "bds_sort_network.h"
+
+/// ===============================================================
+/// Sort tuning parameters
+/// ===============================================================
+///
+/// Compile-time thresholds of the comparison sorts. The values below
+/// are defaults; `make tune` times candidate values on the build
+/// machine and writes the winners to a generated bds_tuning.h, which
+/// the Makefile hands in as BDS_TUNING_HEADER. Anything defined on the
+/// command line (-DQUICK_LEAF_THRESHOLD=24) wins over both.
+/// ===============================================================
+
+#ifdef BDS_TUNING_HEADER
+#include BDS_TUNING_HEADER
+#endif
+
+// QuickSort / IntroSort: ranges up to this size go to a sorting network
+#ifndef QUICK_LEAF_THRESHOLD
+#define QUICK_LEAF_THRESHOLD 16
+#endif
+
+#ifndef INTRO_LEAF_THRESHOLD
+#define INTRO_LEAF_THRESHOLD 16
+#endif
+
+// TimSort: arrays shorter than this are one network-sorted run; longer ones
+// get a minrun in [TIM_MIN_MERGE / 2, TIM_MIN_MERGE]
+#ifndef TIM_MIN_MERGE
+#define TIM_MIN_MERGE 64
+#endif
+
+// TimSort: run stack depth. Run lengths grow at least like Fibonacci numbers,
+// so 40 entries of minrun ≥ 8 cover more than 2^30 elements. A safety bound,
+// not a speed knob: `make tune` leaves it alone.
+#ifndef TIM_STACK_MAX
+#define TIM_STACK_MAX 40
+#endif
+
+// ShellSort gap sequence
+#define SHELL_GAPS_HIBBARD 0  // 1, 3, 7, 15, ...  (2^k − 1)
+#define SHELL_GAPS_KNUTH   1  // 1, 4, 13, 40, ... ((3^k − 1) / 2)
+#define SHELL_GAPS_CIURA   2  // 1, 4, 10, 23, 57, 132, 301, 701, then ×2.25
+
+#ifndef SHELL_GAP_SEQUENCE
+#define SHELL_GAP_SEQUENCE 0
+#endif
+
+#if QUICK_LEAF_THRESHOLD < 3 || QUICK_LEAF_THRESHOLD > SORT_NETWORK_MAX_LENGTH
+#error "QUICK_LEAF_THRESHOLD must be in [3, SORT_NETWORK_MAX_LENGTH]"
+#endif
+
+#if INTRO_LEAF_THRESHOLD < 3 || INTRO_LEAF_THRESHOLD > SORT_NETWORK_MAX_LENGTH
+#error "INTRO_LEAF_THRESHOLD must be in [3, SORT_NETWORK_MAX_LENGTH]"
+#endif
+
+#if TIM_MIN_MERGE < 16 || TIM_MIN_MERGE > SORT_NETWORK_MAX_LENGTH
+#error "TIM_MIN_MERGE must be in [16, SORT_NETWORK_MAX_LENGTH]"
+#endif
+
+#if TIM_STACK_MAX < 40
+#error "TIM_STACK_MAX below 40 can overflow on large arrays"
+#endif
+
+#if SHELL_GAP_SEQUENCE < SHELL_GAPS_HIBBARD || SHELL_GAP_SEQUENCE > SHELL_GAPS_CIURA
+#error "SHELL_GAP_SEQUENCE must be one of the SHELL_GAPS_* values"
+#endif
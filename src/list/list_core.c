@@ -1,12 +1,15 @@
 /// Basic list operations
 
 #include "../../include/bds/list/bds_list_core.h"
+#include "../../include/bds/bds_stats.h"
 
 #include <stdlib.h>
 
 /// Lifecycle
 
 ListNode *listNodeNew(void *data) {
+    BDS_STATS_ADD(allocs, 1);
+
     ListNode *node = (ListNode *)malloc(sizeof *node);
     if (!node) return NULL;
 
@@ -0,0 +1,23 @@
+/// Operation counters
+
+#include "../../include/bds/bds_stats.h"
+
+// Always defined, so code built with BDS_STATS still links against a library built without it
+_Thread_local BdsStats bds_stats_counters;
+
+BdsStats bdsStatsSnapshot(void) {
+    return bds_stats_counters;
+}
+
+void bdsStatsReset(void) {
+    const BdsStats zero = { 0, 0, 0, 0, 0 };
+    bds_stats_counters = zero;
+}
+
+bool bdsStatsEnabled(void) {
+#ifdef BDS_STATS
+    return true;
+#else
+    return false;
+#endif
+}
@@ -1,10 +1,15 @@
+#define _POSIX_C_SOURCE 200809L  // fileno, lseek, mkstemp: external sort and mapping tests
+
 #include "../include/bds/array/bds_array.h"
+#include "../include/bds/bds_config.h"  // PARALLEL_MIN_CHUNK_LENGTH
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>  // size_t, SIZE_MAX
+#include <string.h>  // memcpy
+#include <unistd.h>  // write, read, lseek
 
 // ======================================================
 // Mini framework de tests
@@ -398,6 +403,64 @@ static void test_array_find_and_count(void) {
     }
 }
 
+static void test_array_binary_search(void) {
+    // 32 ints with repeated values (1..8), sorted first
+    Array *a = build_int_array_32();
+    TEST_ASSERT(a != NULL);
+    if (!a) return;
+
+    arrayInsertionSort(a, key_int);
+
+    ArraySearchIndex *index = arrayBuildSearchIndex(a, key_int);
+    TEST_ASSERT(index != NULL);
+    TEST_ASSERT_EQ_SIZE(INT32_LEN, searchIndexLength(index));
+
+    // Targets below, inside (every value) and above the stored range
+    for (int target = -1; target <= 10; ++target) {
+        size_t expected_lo = 0;
+        while (expected_lo < INT32_LEN && key_int(arrayGet(a, expected_lo)) < target) expected_lo++;
+
+        size_t expected_hi = expected_lo;
+        while (expected_hi < INT32_LEN && key_int(arrayGet(a, expected_hi)) == target) expected_hi++;
+
+        TEST_ASSERT_EQ_SIZE(expected_lo, arrayLowerBound(a, target, key_int));
+        TEST_ASSERT_EQ_SIZE(expected_hi, arrayUpperBound(a, target, key_int));
+        TEST_ASSERT_EQ_SIZE(expected_lo, arrayLowerBoundPrefetch(a, target, key_int));
+        TEST_ASSERT_EQ_SIZE(expected_hi, arrayUpperBoundPrefetch(a, target, key_int));
+
+        if (index) {
+            TEST_ASSERT_EQ_SIZE(expected_lo, searchIndexLowerBound(index, target));
+            TEST_ASSERT_EQ_SIZE(expected_hi, searchIndexUpperBound(index, target));
+        }
+
+        const ArrayRange range = arrayEqualRange(a, target, key_int);
+        TEST_ASSERT_EQ_SIZE(expected_lo, range.lo);
+        TEST_ASSERT_EQ_SIZE(expected_hi, range.hi);
+
+        // Any hint (even past the end) must give the lower bound
+        size_t gallop_wrong = 0;
+        for (size_t hint = 0; hint <= INT32_LEN + 1; ++hint) {
+            if (arrayGallopSearch(a, hint, target, key_int) != expected_lo) gallop_wrong++;
+        }
+        TEST_ASSERT_EQ_SIZE(0u, gallop_wrong);
+    }
+
+    searchIndexFree(index);
+    arrayFree(a);
+
+    // Empty array: everything is "past the end" = 0
+    Array *empty = arrayNew(0);
+    TEST_ASSERT(empty != NULL);
+    TEST_ASSERT_EQ_SIZE(0u, arrayLowerBound(empty, 3, key_int));
+    TEST_ASSERT_EQ_SIZE(0u, arrayGallopSearch(empty, 5, 3, key_int));
+
+    ArraySearchIndex *empty_index = arrayBuildSearchIndex(empty, key_int);
+    TEST_ASSERT(empty_index != NULL);
+    TEST_ASSERT_EQ_SIZE(0u, searchIndexLowerBound(empty_index, 3));
+    searchIndexFree(empty_index);
+    arrayFree(empty);
+}
+
 // ======================================================
 // Tests de arrayFreeWith + deleter
 // ======================================================
@@ -533,10 +596,16 @@ static void test_array_sort_inplace(void) {
     test_one_sort_inplace(arrayCocktailShakerSort);
     test_one_sort_inplace(arrayGnomeSort);
     test_one_sort_inplace(arrayMergeSort);
+    test_one_sort_inplace(arrayBottomUpMergeSort);
     test_one_sort_inplace(arrayTimSort);
+    test_one_sort_inplace(arrayBlockMergeSort);
     test_one_sort_inplace(arrayIntroSort);
+    test_one_sort_inplace(arrayPdqSort);
     test_one_sort_inplace(arrayShellSort);
     test_one_sort_inplace(arrayQuickSort);
+    test_one_sort_inplace(arrayRadixSort);
+    test_one_sort_inplace(arrayIntroSortCached);
+    test_one_sort_inplace(arrayTimSortCached);
 }
 
 static void test_array_sort_new_arrays(void) {
@@ -546,10 +615,1092 @@ static void test_array_sort_new_arrays(void) {
     test_one_sort_newarray(arrayCocktailShakerSorted);
     test_one_sort_newarray(arrayGnomeSorted);
     test_one_sort_newarray(arrayMergeSorted);
+    test_one_sort_newarray(arrayBottomUpMergeSorted);
     test_one_sort_newarray(arrayTimSorted);
+    test_one_sort_newarray(arrayBlockMergeSorted);
     test_one_sort_newarray(arrayIntroSorted);
+    test_one_sort_newarray(arrayPdqSorted);
     test_one_sort_newarray(arrayShellSorted);
     test_one_sort_newarray(arrayQuickSorted);
+    test_one_sort_newarray(arrayRadixSorted);
+    test_one_sort_newarray(arrayIntroSortedCached);
+    test_one_sort_newarray(arrayTimSortedCached);
+}
+
+// ======================================================
+// Key-cached sorting tests
+// ======================================================
+
+static unsigned int g_key_calls = 0;
+
+static int key_dummy_payload_counted(const void *elem) {
+    g_key_calls++;
+    return key_dummy_payload(elem);
+}
+
+static void assert_array_stable_by_key(const Array *a, key_val_func key) {
+    // dummy1 holds the original position of each payload
+    for (size_t i = 1; i < arrayLength(a); ++i) {
+        const DummyPayload *prev = (const DummyPayload *)arrayGet(a, i - 1);
+        const DummyPayload *curr = (const DummyPayload *)arrayGet(a, i);
+
+        if (key(prev) == key(curr)) {
+            TEST_ASSERT(prev->dummy1 < curr->dummy1);
+        }
+    }
+}
+
+static void test_array_sort_cached(void) {
+    const sort_inplace_func cached_sorters[] = {
+        arrayIntroSortCached,
+        arrayPdqSort,
+        arrayTimSortCached,
+        arrayRadixSort,
+    };
+
+    for (size_t s = 0; s < sizeof(cached_sorters) / sizeof(cached_sorters[0]); ++s) {
+        Array *a = build_struct_array_56();
+        TEST_ASSERT(a != NULL);
+        if (!a) continue;
+
+        g_key_calls = 0;
+        cached_sorters[s](a, key_dummy_payload_counted);
+
+        // Exactly one key extraction per element
+        TEST_ASSERT_EQ_UINT(STRUCT_ARR_LEN, g_key_calls);
+        assert_array_sorted_by_key(a, key_dummy_payload);
+
+        arrayFree(a);
+    }
+
+    // Generic adapter keeps the wrapped sorter's stability
+    Array *a = build_struct_array_56();
+    TEST_ASSERT(a != NULL);
+
+    if (a) {
+        g_key_calls = 0;
+        arraySortCached(a, key_dummy_payload_counted, arrayMergeSort);
+
+        TEST_ASSERT_EQ_UINT(STRUCT_ARR_LEN, g_key_calls);
+        assert_array_sorted_by_key(a, key_dummy_payload);
+        assert_array_stable_by_key(a, key_dummy_payload);
+
+        arrayFree(a);
+    }
+
+    // TimSort cached and radix sort are stable on their own
+    const sort_inplace_func stable_sorters[] = {
+        arrayTimSortCached,
+        arrayRadixSort,
+    };
+
+    for (size_t s = 0; s < sizeof(stable_sorters) / sizeof(stable_sorters[0]); ++s) {
+        Array *b = build_struct_array_56();
+        TEST_ASSERT(b != NULL);
+        if (!b) continue;
+
+        stable_sorters[s](b, key_dummy_payload);
+        assert_array_stable_by_key(b, key_dummy_payload);
+        arrayFree(b);
+    }
+}
+
+// ======================================================
+// Sort workspace tests
+// ======================================================
+
+typedef void (*sort_ctx_func)(Array *array, key_val_func key, BdsSortContext *ctx);
+
+static void test_array_sort_context(void) {
+    const sort_ctx_func ctx_sorters[] = {
+        arrayMergeSortCtx,
+        arrayBottomUpMergeSortCtx,
+        arrayTimSortCtx,
+        arrayRadixSortCtx,
+        arrayTimSortCachedCtx,
+        arrayPdqSortCtx,
+        arrayIntroSortCachedCtx,
+    };
+    const size_t stable_count = 5;  // the first five are stable
+
+    BdsSortContext *ctx = sortContextNew();
+    TEST_ASSERT(ctx != NULL);
+    if (!ctx) return;
+
+    TEST_ASSERT(sortContextReserve(ctx, STRUCT_ARR_LEN));
+
+    // The same context is reused by every sort, twice over
+    for (size_t round = 0; round < 2; ++round) {
+        for (size_t s = 0; s < sizeof(ctx_sorters) / sizeof(ctx_sorters[0]); ++s) {
+            Array *a = build_struct_array_56();
+            TEST_ASSERT(a != NULL);
+            if (!a) continue;
+
+            ctx_sorters[s](a, key_dummy_payload, ctx);
+            assert_array_sorted_by_key(a, key_dummy_payload);
+            if (s < stable_count) assert_array_stable_by_key(a, key_dummy_payload);
+
+            arrayFree(a);
+
+            Array *b = build_int_array_32();
+            TEST_ASSERT(b != NULL);
+            if (!b) continue;
+
+            ctx_sorters[s](b, key_int, ctx);
+            assert_array_sorted_by_key(b, key_int);
+
+            arrayFree(b);
+        }
+    }
+
+    sortContextFree(ctx);
+
+    // NULL context falls back to the plain sort
+    Array *a = build_int_array_12();
+    TEST_ASSERT(a != NULL);
+
+    if (a) {
+        arrayTimSortCtx(a, key_int, NULL);
+        assert_array_sorted_by_key(a, key_int);
+        arrayFree(a);
+    }
+
+    sortContextFree(NULL);
+}
+
+// ======================================================
+// Parallel sorting tests
+// ======================================================
+
+#define BIG_ARR_LEN 50000u
+
+// Large enough to give several workers a chunk each
+static DummyPayload *build_big_payloads(void) {
+    DummyPayload *payloads = (DummyPayload *)malloc(BIG_ARR_LEN * sizeof(DummyPayload));
+    if (!payloads) return NULL;
+
+    unsigned int state = 12345u;
+
+    for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+        state = state * 1103515245u + 12345u;
+        payloads[i].important_value = (int)((state >> 8) % 2001u) - 1000;  // many duplicates
+        payloads[i].dummy1 = (int)i;
+        payloads[i].dummy2 = 0;
+    }
+
+    return payloads;
+}
+
+static Array *build_big_array(DummyPayload *payloads) {
+    Array *a = arrayNew(BIG_ARR_LEN);
+    if (!a) return NULL;
+
+    for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+        arraySet(a, i, &payloads[i]);
+    }
+
+    return a;
+}
+
+static void parallel_merge_sort_all_threads(Array *array, key_val_func key) {
+    arrayParallelMergeSort(array, key, 0);
+}
+
+static void parallel_intro_sort_all_threads(Array *array, key_val_func key) {
+    arrayParallelIntroSort(array, key, 0);
+}
+
+static void parallel_odd_even_sort_all_threads(Array *array, key_val_func key) {
+    arrayParallelOddEvenSort(array, key, 0);
+}
+
+static void parallel_block_odd_even_sort_all_threads(Array *array, key_val_func key) {
+    arrayParallelBlockOddEvenSort(array, key, 0);
+}
+
+static void test_array_parallel_sort(void) {
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    const size_t thread_counts[] = { 1u, 3u, 4u, 0u };
+
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+        Array *a = build_big_array(payloads);
+        TEST_ASSERT(a != NULL);
+        if (!a) continue;
+
+        arrayParallelMergeSort(a, key_dummy_payload, thread_counts[t]);
+
+        assert_array_sorted_by_key(a, key_dummy_payload);
+        assert_array_stable_by_key(a, key_dummy_payload);
+
+        arrayFree(a);
+
+        Array *b = build_big_array(payloads);
+        TEST_ASSERT(b != NULL);
+        if (!b) continue;
+
+        arrayParallelIntroSort(b, key_dummy_payload, thread_counts[t]);
+        assert_array_sorted_by_key(b, key_dummy_payload);
+
+        arrayFree(b);
+
+        Array *c = build_big_array(payloads);
+        TEST_ASSERT(c != NULL);
+        if (!c) continue;
+
+        arrayParallelBlockOddEvenSort(c, key_dummy_payload, thread_counts[t]);
+        assert_array_sorted_by_key(c, key_dummy_payload);
+        assert_array_stable_by_key(c, key_dummy_payload);
+
+        arrayFree(c);
+
+        // O(n²): a prefix long enough for two workers
+        Array *d = build_big_array(payloads);
+        TEST_ASSERT(d != NULL);
+        if (!d) continue;
+
+        d->length = 2 * PARALLEL_MIN_CHUNK_LENGTH + 1;
+        arrayParallelOddEvenSort(d, key_dummy_payload, thread_counts[t]);
+        assert_array_sorted_by_key(d, key_dummy_payload);
+        assert_array_stable_by_key(d, key_dummy_payload);
+
+        arrayFree(d);
+    }
+
+    // Tiny inputs fall back to a single worker
+    test_one_sort_inplace(parallel_merge_sort_all_threads);
+    test_one_sort_inplace(parallel_intro_sort_all_threads);
+    test_one_sort_inplace(parallel_odd_even_sort_all_threads);
+    test_one_sort_inplace(parallel_block_odd_even_sort_all_threads);
+
+    free(payloads);
+}
+
+// ======================================================
+// Parallel find tests
+// ======================================================
+
+static bool filter_struct_is_1000(const void *elem) {
+    return ((const DummyPayload *)elem)->important_value == 1000;  // ~1 in 2000 big payloads
+}
+
+static bool filter_struct_above_1000(const void *elem) {
+    return ((const DummyPayload *)elem)->important_value > 1000;
+}
+
+static void test_array_parallel_find(void) {
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    Array *a = build_big_array(payloads);
+    TEST_ASSERT(a != NULL);
+    if (!a) {
+        free(payloads);
+        return;
+    }
+
+    const size_t thread_counts[] = { 1u, 3u, 4u, 0u };
+
+    for (int late = 0; late <= 1; ++late) {
+        // Second round: the only match for > 1000 is the last element, also the max
+        if (late) payloads[BIG_ARR_LEN - 1].important_value = 1001;
+
+        for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+            const size_t threads = thread_counts[t];
+
+            TEST_ASSERT_EQ_SIZE((size_t)arrayCount(a, filter_struct_important_positive),
+                                arrayParallelCount(a, filter_struct_important_positive, threads));
+            TEST_ASSERT_EQ_SIZE((size_t)arrayCount(a, filter_struct_is_1000),
+                                arrayParallelCount(a, filter_struct_is_1000, threads));
+
+            TEST_ASSERT_EQ_SIZE(arrayIdxOf(a, filter_struct_important_positive),
+                                arrayParallelIdxOf(a, filter_struct_important_positive, threads));
+            TEST_ASSERT_EQ_SIZE(arrayIdxOf(a, filter_struct_is_1000),
+                                arrayParallelIdxOf(a, filter_struct_is_1000, threads));
+            TEST_ASSERT_EQ_SIZE(late ? BIG_ARR_LEN - 1u : SIZE_MAX,
+                                arrayParallelIdxOf(a, filter_struct_above_1000, threads));
+
+            // Keys repeat: the first of the tied minima / maxima
+            TEST_ASSERT_EQ_SIZE(arrayMinIdx(a, key_dummy_payload), arrayParallelMinIdx(a, key_dummy_payload, threads));
+            TEST_ASSERT_EQ_SIZE(arrayMaxIdx(a, key_dummy_payload), arrayParallelMaxIdx(a, key_dummy_payload, threads));
+        }
+    }
+
+    TEST_ASSERT_EQ_SIZE(BIG_ARR_LEN - 1u, arrayParallelMaxIdx(a, key_dummy_payload, 0));
+
+    arrayFree(a);
+    free(payloads);
+
+    // Short arrays run on the calling thread
+    Array *a12 = build_int_array_12();
+    TEST_ASSERT(a12 != NULL);
+
+    if (a12) {
+        TEST_ASSERT_EQ_SIZE(5u, arrayParallelCount(a12, filter_int_is_negative, 0));
+        TEST_ASSERT_EQ_SIZE(0u, arrayParallelIdxOf(a12, filter_int_is_negative, 0));
+        TEST_ASSERT_EQ_SIZE(8u, arrayParallelMinIdx(a12, key_int, 0));
+        TEST_ASSERT_EQ_SIZE(6u, arrayParallelMaxIdx(a12, key_int, 0));
+
+        arrayFree(a12);
+    }
+}
+
+// ======================================================
+// Pipeline tests
+// ======================================================
+
+static size_t g_pipe_filter_calls;
+
+static bool filter_int_is_negative_counted(const void *elem) {
+    g_pipe_filter_calls++;
+    return filter_int_is_negative(elem);
+}
+
+static void *map_payload_dummy1(const void *elem) {
+    return &((DummyPayload *)elem)->dummy1;
+}
+
+static void reduce_sum_int(void *acc, const void *elem) {
+    *(long long *)acc += *(const int *)elem;
+}
+
+static void combine_sum(void *acc, const void *other) {
+    *(long long *)acc += *(const long long *)other;
+}
+
+static void test_array_pipe(void) {
+    // ---- take: stops the pass after the n-th output ----
+    Array *a12 = build_int_array_12();  // -5, 3, 0, -2, 8, -1, 10, 7, -9, 4, -3, 2
+    TEST_ASSERT(a12 != NULL);
+
+    if (a12) {
+        BdsPipe pipe = bdsPipeFrom(a12);
+        bdsPipeTake(bdsPipeFilter(&pipe, filter_int_is_negative_counted), 3);
+
+        g_pipe_filter_calls = 0;
+        Array *negatives = bdsPipeCollect(&pipe);
+        TEST_ASSERT(negatives != NULL);
+        TEST_ASSERT_EQ_SIZE(6u, g_pipe_filter_calls);  // up to the third negative, at index 5
+
+        if (negatives) {
+            TEST_ASSERT_EQ_SIZE(3u, arrayLength(negatives));
+            TEST_ASSERT(arrayGet(negatives, 0) == &g_int_data_12[0]);
+            TEST_ASSERT(arrayGet(negatives, 1) == &g_int_data_12[3]);
+            TEST_ASSERT(arrayGet(negatives, 2) == &g_int_data_12[5]);
+            arrayFree(negatives);
+        }
+
+        // Terminals can be rerun: take counters are not kept in the pipe
+        TEST_ASSERT_EQ_SIZE(3u, bdsPipeCount(&pipe));
+        TEST_ASSERT_EQ_SIZE(3u, bdsPipeParallelCount(&pipe, 0));
+
+        long long sum = 0;
+        TEST_ASSERT(bdsPipeReduce(&pipe, &sum, reduce_sum_int));
+        TEST_ASSERT_EQ_INT(-8, (int)sum);
+
+        BdsPipe none = bdsPipeFrom(a12);
+        bdsPipeTake(&none, 0);
+        TEST_ASSERT_EQ_SIZE(0u, bdsPipeCount(&none));
+
+        // Too many stages: every terminal fails
+        BdsPipe broken = bdsPipeFrom(a12);
+        for (size_t s = 0; s <= BDS_PIPE_MAX_STAGES; ++s) bdsPipeFilter(&broken, filter_int_is_negative);
+        TEST_ASSERT(broken.broken);
+        TEST_ASSERT_EQ_SIZE(0u, bdsPipeCount(&broken));
+        TEST_ASSERT(bdsPipeCollect(&broken) == NULL);
+        TEST_ASSERT(!bdsPipeReduce(&broken, &sum, reduce_sum_int));
+
+        arrayFree(a12);
+    }
+
+    // ---- filter → map over chunks: parallel terminals match the serial ones ----
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    Array *big = build_big_array(payloads);
+    TEST_ASSERT(big != NULL);
+
+    if (big) {
+        size_t expected_count = 0;
+        long long expected_sum = 0;
+
+        for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+            if (payloads[i].important_value > 0) {
+                expected_count++;
+                expected_sum += payloads[i].dummy1;
+            }
+        }
+
+        BdsPipe pipe = bdsPipeFrom(big);
+        bdsPipeMap(bdsPipeFilter(&pipe, filter_struct_important_positive), map_payload_dummy1);
+
+        const size_t thread_counts[] = { 1u, 3u, 4u, 0u };
+
+        for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+            const size_t threads = thread_counts[t];
+
+            TEST_ASSERT_EQ_SIZE(expected_count, bdsPipeParallelCount(&pipe, threads));
+
+            long long sum = 0;
+            TEST_ASSERT(bdsPipeParallelReduce(&pipe, &sum, sizeof(sum), reduce_sum_int, combine_sum, threads));
+            TEST_ASSERT(sum == expected_sum);
+
+            Array *collected = bdsPipeParallelCollect(&pipe, threads);
+            TEST_ASSERT(collected != NULL);
+            if (!collected) continue;
+
+            TEST_ASSERT_EQ_SIZE(expected_count, arrayLength(collected));
+
+            // Source order: dummy1 is the original index, so it must increase
+            bool ordered = true;
+            for (size_t i = 1; i < arrayLength(collected); ++i) {
+                if (*(int *)arrayGet(collected, i - 1) >= *(int *)arrayGet(collected, i)) ordered = false;
+            }
+            TEST_ASSERT(ordered);
+
+            arrayFree(collected);
+        }
+
+        TEST_ASSERT_EQ_SIZE(expected_count, bdsPipeCount(&pipe));
+
+        arrayFree(big);
+    }
+
+    free(payloads);
+}
+
+// ======================================================
+// View tests
+// ======================================================
+
+static void test_array_view(void) {
+    Array *a = build_int_array_12();  // -5, 3, 0, -2, 8, -1, 10, 7, -9, 4, -3, 2
+    TEST_ASSERT(a != NULL);
+    if (!a) return;
+
+    // Window [3, 9): -2, 8, -1, 10, 7, -9
+    ArrayView view = arraySlice(a, 3, 9);
+    TEST_ASSERT_EQ_SIZE(6u, arrayLength(&view));
+    TEST_ASSERT(arrayGet(&view, 0) == &g_int_data_12[3]);
+
+    // Find and count see only the window; indexes are relative to it
+    TEST_ASSERT_EQ_SIZE(0u, arrayIdxOf(&view, filter_int_is_negative));
+    TEST_ASSERT_EQ_UINT(3u, arrayCount(&view, filter_int_is_negative));
+    TEST_ASSERT_EQ_SIZE(5u, arrayMinIdx(&view, key_int));
+    TEST_ASSERT_EQ_SIZE(3u, arrayMaxIdx(&view, key_int));
+
+    // Read-only slice of a const parent: same window
+    const Array *parent = a;
+    ArrayView storage;
+    const ArrayView *read_only = arraySliceConst(parent, 3, 9, &storage);
+    TEST_ASSERT(read_only == &storage);
+    TEST_ASSERT_EQ_SIZE(6u, arrayLength(read_only));
+    TEST_ASSERT_EQ_UINT(3u, arrayCount(read_only, filter_int_is_negative));
+    TEST_ASSERT(arraySliceConst(parent, 9, 3, &storage)->length == 0);
+
+    // A Sorted copy of the window leaves the parent alone
+    Array *sorted_copy = arrayTimSorted(&view, key_int);
+    TEST_ASSERT(sorted_copy != NULL);
+    if (sorted_copy) {
+        TEST_ASSERT_EQ_SIZE(6u, arrayLength(sorted_copy));
+        assert_array_sorted_by_key(sorted_copy, key_int);
+        arrayFree(sorted_copy);
+    }
+    TEST_ASSERT(arrayGet(a, 3) == &g_int_data_12[3]);
+
+    // Sorting the view permutes just the window inside the parent
+    arraySort(&view, key_int, BDS_SORT_DEFAULT);
+    assert_array_sorted_by_key(&view, key_int);
+
+    const int expected[INT12_LEN] = { -5, 3, 0, -9, -2, -1, 7, 8, 10, 4, -3, 2 };
+    for (size_t i = 0; i < INT12_LEN; ++i) {
+        TEST_ASSERT_EQ_INT(expected[i], key_int(arrayGet(a, i)));
+    }
+
+    TEST_ASSERT_EQ_SIZE(2u, arrayLowerBound(&view, -1, key_int));
+    TEST_ASSERT_EQ_SIZE(6u, arrayUpperBound(&view, 10, key_int));
+
+    // Clamping and empty views
+    ArrayView tail = arraySlice(a, 10, 100);
+    TEST_ASSERT_EQ_SIZE(2u, arrayLength(&tail));
+
+    ArrayView empty = arraySlice(a, 7, 7);
+    TEST_ASSERT(arrayIsEmpty(&empty));
+    TEST_ASSERT_EQ_SIZE(SIZE_MAX, arrayIdxOf(&empty, filter_int_is_negative));
+    arrayQuickSort(&empty, key_int);
+
+    ArrayView none = arraySlice(NULL, 0, 4);
+    TEST_ASSERT_EQ_SIZE(0u, arrayLength(&none));
+
+    arrayFree(a);
+}
+
+// ======================================================
+// Duplicate-heavy sorting tests
+// ======================================================
+
+static void test_array_sort_few_distinct_keys(void) {
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    // Only three distinct keys: 3-way partitions must not degrade
+    for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+        payloads[i].important_value %= 3;
+    }
+
+    const sort_inplace_func sorters[] = {
+        arrayQuickSort,
+        arrayIntroSort,
+        arrayIntroSortCached,
+        arrayPdqSort,
+    };
+
+    for (size_t s = 0; s < sizeof(sorters) / sizeof(sorters[0]); ++s) {
+        Array *a = build_big_array(payloads);
+        TEST_ASSERT(a != NULL);
+        if (!a) continue;
+
+        sorters[s](a, key_dummy_payload);
+        assert_array_sorted_by_key(a, key_dummy_payload);
+
+        arrayFree(a);
+    }
+
+    // Many levels of ping-pong merges over long equal-key runs
+    Array *b = build_big_array(payloads);
+    TEST_ASSERT(b != NULL);
+
+    if (b) {
+        arrayBottomUpMergeSort(b, key_dummy_payload);
+        assert_array_sorted_by_key(b, key_dummy_payload);
+        assert_array_stable_by_key(b, key_dummy_payload);
+        arrayFree(b);
+    }
+
+    free(payloads);
+}
+
+// ======================================================
+// Block merge sort tests
+// ======================================================
+
+static void test_array_block_merge_sort(void) {
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    // Runs far longer than the buffer: rotation merges at every upper level.
+    // Shapes: random (many duplicates), three keys, descending with ties
+    for (int shape = 0; shape < 3; ++shape) {
+        for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+            if (shape == 1) payloads[i].important_value %= 3;
+            if (shape == 2) payloads[i].important_value = -(int)(i / 7);
+        }
+
+        Array *a = build_big_array(payloads);
+        TEST_ASSERT(a != NULL);
+        if (!a) continue;
+
+        arrayBlockMergeSort(a, key_dummy_payload);
+        TEST_ASSERT_EQ_SIZE(BIG_ARR_LEN, arrayLength(a));
+        assert_array_sorted_by_key(a, key_dummy_payload);
+        assert_array_stable_by_key(a, key_dummy_payload);
+
+        arrayFree(a);
+    }
+
+    free(payloads);
+}
+
+// ======================================================
+// External sort tests
+// ======================================================
+
+#define EXT_RECORDS 100000u
+
+// Records are { int32 key, int32 seq, filler }; key() reads the first 4 bytes
+static int key_record_bytes(const void *record) {
+    int32_t key;
+    memcpy(&key, record, sizeof(key));
+    return key;
+}
+
+static int temp_fd(void) {
+    FILE *file = tmpfile();
+    return file ? fileno(file) : -1;  // Closed at exit
+}
+
+// Checks out_fd holds `count` records sorted by key, ties in seq order
+static void assert_external_sorted(const int out_fd, const size_t record_size, const size_t count) {
+    TEST_ASSERT(lseek(out_fd, 0, SEEK_SET) == 0);
+
+    unsigned char record[64];
+    int32_t prev_key = INT32_MIN, prev_seq = -1;
+    size_t seen = 0;
+    bool ordered = true;
+
+    while (1) {
+        size_t length = record_size;
+
+        if (length == 0) {
+            uint32_t prefix;
+            if (read(out_fd, &prefix, sizeof(prefix)) != (ssize_t)sizeof(prefix)) break;
+            length = prefix;
+        }
+
+        if (length > sizeof(record) || read(out_fd, record, length) != (ssize_t)length) break;
+
+        int32_t key, seq;
+        memcpy(&key, record, sizeof(key));
+        memcpy(&seq, record + 4, sizeof(seq));
+
+        if (key < prev_key || (key == prev_key && seq < prev_seq)) ordered = false;
+        prev_key = key;
+        prev_seq = seq;
+        seen++;
+    }
+
+    TEST_ASSERT(ordered);
+    TEST_ASSERT_EQ_SIZE(count, seen);
+}
+
+static void test_array_external_sort(void) {
+    // Small budget: dozens of runs and more than one merge pass; serial and double-buffered
+    for (size_t case_idx = 0; case_idx < 4; ++case_idx) {
+        const size_t record_size = case_idx % 2 ? 8 : 0;
+        const size_t nthreads = case_idx < 2 ? 1 : 2;
+
+        const int in_fd = temp_fd();
+        const int out_fd = temp_fd();
+        TEST_ASSERT(in_fd >= 0 && out_fd >= 0);
+        if (in_fd < 0 || out_fd < 0) return;
+
+        unsigned int state = 777u;
+        for (uint32_t i = 0; i < EXT_RECORDS; ++i) {
+            unsigned char record[4 + 48] = { 0 };
+            const uint32_t payload = record_size ? 8u : 8u + i % 41u;  // prefixed: 8..48 bytes
+
+            state = state * 1103515245u + 12345u;
+            const int32_t key = (int32_t)((state >> 8) % 1000u) - 500;
+            const int32_t seq = (int32_t)i;
+
+            size_t offset = 0;
+            if (!record_size) {
+                memcpy(record, &payload, 4);
+                offset = 4;
+            }
+            memcpy(record + offset, &key, 4);
+            memcpy(record + offset + 4, &seq, 4);
+
+            TEST_ASSERT(write(in_fd, record, offset + payload) == (ssize_t)(offset + payload));
+        }
+        TEST_ASSERT(lseek(in_fd, 0, SEEK_SET) == 0);
+
+        const ExternalSortConfig config = { record_size, 64u << 10, NULL, NULL, nthreads };
+        TEST_ASSERT(arrayExternalSort(in_fd, out_fd, key_record_bytes, &config));
+        assert_external_sorted(out_fd, record_size, EXT_RECORDS);
+    }
+
+    // Fits in memory (written straight to the output); then a truncated record
+    {
+        const int in_fd = temp_fd();
+        const int out_fd = temp_fd();
+        TEST_ASSERT(in_fd >= 0 && out_fd >= 0);
+        if (in_fd < 0 || out_fd < 0) return;
+
+        for (int32_t i = 0; i < 100; ++i) {
+            const int32_t record[2] = { (i * 37) % 100, i };
+            TEST_ASSERT(write(in_fd, record, sizeof(record)) == (ssize_t)sizeof(record));
+        }
+        TEST_ASSERT(lseek(in_fd, 0, SEEK_SET) == 0);
+
+        const ExternalSortConfig config = { 8, 0, arrayPdqSort, NULL, 0 };
+        TEST_ASSERT(arrayExternalSort(in_fd, out_fd, key_record_bytes, &config));
+        assert_external_sorted(out_fd, 8, 100);
+
+        TEST_ASSERT(write(in_fd, "abcd", 4) == 4);  // 804 bytes: not a multiple of 8
+        TEST_ASSERT(lseek(in_fd, 0, SEEK_SET) == 0);
+        TEST_ASSERT(!arrayExternalSort(in_fd, out_fd, key_record_bytes, &config));
+    }
+}
+
+// ======================================================
+// Memory-mapped array tests
+// ======================================================
+
+#define MAP_RECORDS 10000u
+
+static void test_array_map(void) {
+    char path[] = "/tmp/bds-test-map-XXXXXX";
+    const int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    if (fd < 0) return;
+
+    // { key, seq } records, keys descending
+    for (int32_t i = 0; i < (int32_t)MAP_RECORDS; ++i) {
+        const int32_t record[2] = { (int32_t)MAP_RECORDS - i, i };
+        TEST_ASSERT(write(fd, record, sizeof(record)) == (ssize_t)sizeof(record));
+    }
+    close(fd);
+
+    Array *a = arrayMapFile(path, 2 * sizeof(int32_t), ARRAY_MAP_RANDOM | ARRAY_MAP_POPULATE);
+    TEST_ASSERT(a != NULL);
+
+    if (a) {
+        TEST_ASSERT_EQ_SIZE(MAP_RECORDS, arrayLength(a));
+        TEST_ASSERT_EQ_INT((int)MAP_RECORDS, key_record_bytes(arrayGet(a, 0)));
+
+        // Sorting moves pointers only: the file keeps its order
+        arraySort(a, key_record_bytes, BDS_SORT_DEFAULT);
+        bool ordered = true;
+        for (size_t i = 0; i < MAP_RECORDS; ++i) {
+            if (key_record_bytes(arrayGet(a, i)) != (int)i + 1) ordered = false;
+        }
+        TEST_ASSERT(ordered);
+        TEST_ASSERT(arrayGet(a, MAP_RECORDS - 1) < arrayGet(a, 0));  // record 0 sits first in the mapping
+
+        arrayUnmap(a);
+    }
+
+    // Record size that does not divide the file
+    TEST_ASSERT(arrayMapFile(path, 3, ARRAY_MAP_DEFAULT) == NULL);
+    TEST_ASSERT(arrayMapFile("/nonexistent/bds-map", 8, ARRAY_MAP_DEFAULT) == NULL);
+    unlink(path);
+
+    // Anonymous: zero-filled and writable
+    Array *anon = arrayMapAnonymous(MAP_RECORDS, sizeof(int32_t), ARRAY_MAP_SEQUENTIAL);
+    TEST_ASSERT(anon != NULL);
+
+    if (anon) {
+        TEST_ASSERT_EQ_INT(0, key_record_bytes(arrayGet(anon, MAP_RECORDS - 1)));
+
+        for (size_t i = 0; i < MAP_RECORDS; ++i) {
+            const int32_t value = (int32_t)((i * 7919u) % MAP_RECORDS);
+            memcpy(arrayGet(anon, i), &value, sizeof(value));
+        }
+        TEST_ASSERT_EQ_INT(0, key_record_bytes(arrayGet(anon, arrayMinIdx(anon, key_record_bytes))));
+
+        arrayUnmap(anon);
+    }
+
+    Array *empty = arrayMapAnonymous(0, 16, ARRAY_MAP_DEFAULT);
+    TEST_ASSERT(empty != NULL && arrayIsEmpty(empty));
+    arrayUnmap(empty);
+}
+
+// ======================================================
+// Adaptive sort tests
+// ======================================================
+
+static void adaptive_sort_default(Array *array, key_val_func key) {
+    arraySort(array, key, BDS_SORT_DEFAULT);
+}
+
+static Array *adaptive_sorted_stable(const Array *array, key_val_func key) {
+    return arraySorted(array, key, BDS_SORT_STABLE);
+}
+
+static void test_array_adaptive_sort(void) {
+    DummyPayload *payloads = build_big_payloads();
+    int *dense = (int *)malloc(BIG_ARR_LEN * sizeof(int));  // the random keys, reused by every shape
+    TEST_ASSERT(payloads != NULL && dense != NULL);
+    if (!payloads || !dense) {
+        free(payloads);
+        free(dense);
+        return;
+    }
+
+    for (size_t i = 0; i < BIG_ARR_LEN; ++i) dense[i] = payloads[i].important_value;
+
+    // One shape per dispatch path: dense random, wide random, ascending,
+    // descending with ties, strictly descending, organ pipe, perturbed,
+    // few distinct far-apart keys
+    for (int shape = 0; shape < 8; ++shape) {
+        for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+            const int n = (int)BIG_ARR_LEN;
+            const int idx = (int)i;
+            int value = dense[i];
+
+            if (shape == 1) value = dense[i] * 1000003;
+            if (shape == 2) value = idx / 3;
+            if (shape == 3) value = -(idx / 3);
+            if (shape == 4) value = -idx;
+            if (shape == 5) value = idx < n / 2 ? idx / 2 : (n - idx) / 2;
+            if (shape == 6) value = (i % 97 == 0) ? dense[i] * 1000 : idx * 1000;
+            if (shape == 7) value = (dense[i] % 7) * 100000007;
+
+            payloads[i].important_value = value;
+        }
+
+        const unsigned int flags[] = { BDS_SORT_DEFAULT, BDS_SORT_STABLE };
+        const size_t lengths[] = { 200, 1000, BIG_ARR_LEN };  // stack cache, heap cache, long runs
+
+        for (size_t f = 0; f < 2; ++f) {
+            for (size_t l = 0; l < 3; ++l) {
+                Array *a = build_big_array(payloads);
+                TEST_ASSERT(a != NULL);
+                if (!a) continue;
+
+                ArrayView view = arraySlice(a, 0, lengths[l]);
+
+                g_key_calls = 0;
+                arraySort(&view, key_dummy_payload_counted, flags[f]);
+                TEST_ASSERT(g_key_calls == lengths[l]);  // the probe's keys are kept
+
+                assert_array_sorted_by_key(&view, key_dummy_payload);
+                if (flags[f] & BDS_SORT_STABLE) assert_array_stable_by_key(&view, key_dummy_payload);
+
+                arrayFree(a);
+            }
+        }
+    }
+
+    // Small arrays take the sorting network
+    test_one_sort_inplace(adaptive_sort_default);
+    test_one_sort_newarray(adaptive_sorted_stable);
+
+    free(dense);
+    free(payloads);
+}
+
+// ======================================================
+// Type-specialized array tests (BDS_DEFINE_ARRAY)
+// ======================================================
+
+#define PAYLOAD_KEY(p) ((p).important_value)
+
+BDS_DEFINE_ARRAY(IntVec, int, BDS_KEY_IDENTITY)
+BDS_DEFINE_ARRAY(PayloadVec, DummyPayload, PAYLOAD_KEY)
+
+// The parts expand on their own: a heap without the sorts
+BDS_DEFINE_ARRAY_CORE(IntHeap, int)
+BDS_DEFINE_ARRAY_HEAP(IntHeap, int, BDS_KEY_IDENTITY)
+
+static void test_array_template(void) {
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    PayloadVec *sorted = PayloadVecNew(0);
+    PayloadVec *stable = PayloadVecNew(BIG_ARR_LEN);
+    TEST_ASSERT(sorted != NULL && stable != NULL);
+
+    if (sorted && stable) {
+        for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+            TEST_ASSERT(PayloadVecPush(sorted, payloads[i]));
+            *PayloadVecAt(stable, i) = payloads[i];
+        }
+        TEST_ASSERT_EQ_SIZE(BIG_ARR_LEN, PayloadVecLength(sorted));
+        TEST_ASSERT(PayloadVecAt(sorted, BIG_ARR_LEN) == NULL);
+
+        const size_t min_idx = PayloadVecMinIdx(sorted);
+        const size_t max_idx = PayloadVecMaxIdx(sorted);
+
+        PayloadVecSort(sorted);
+        TEST_ASSERT(PayloadVecSortStable(stable));
+
+        size_t unordered = 0;
+        size_t unstable = 0;
+        for (size_t i = 1; i < BIG_ARR_LEN; ++i) {
+            if (sorted->data[i].important_value < sorted->data[i - 1].important_value) unordered++;
+            if (stable->data[i].important_value < stable->data[i - 1].important_value) unordered++;
+            if (stable->data[i].important_value == stable->data[i - 1].important_value &&
+                stable->data[i].dummy1 < stable->data[i - 1].dummy1) unstable++;
+        }
+        TEST_ASSERT_EQ_SIZE(0u, unordered);
+        TEST_ASSERT_EQ_SIZE(0u, unstable);
+
+        TEST_ASSERT_EQ_INT(sorted->data[0].important_value, payloads[min_idx].important_value);
+        TEST_ASSERT_EQ_INT(sorted->data[BIG_ARR_LEN - 1].important_value, payloads[max_idx].important_value);
+
+        // Bounds against a linear scan, including targets outside the key range
+        size_t wrong = 0;
+        for (int target = -1002; target <= 1002; target += 7) {
+            size_t lower = 0;
+            while (lower < BIG_ARR_LEN && sorted->data[lower].important_value < target) lower++;
+            size_t upper = lower;
+            while (upper < BIG_ARR_LEN && sorted->data[upper].important_value == target) upper++;
+
+            if (PayloadVecLowerBound(sorted, target) != lower) wrong++;
+            if (PayloadVecUpperBound(sorted, target) != upper) wrong++;
+            if (PayloadVecIdxOf(sorted, target) != (lower < upper ? lower : SIZE_MAX)) wrong++;
+        }
+        TEST_ASSERT_EQ_SIZE(0u, wrong);
+    }
+
+    PayloadVecFree(sorted);
+    PayloadVecFree(stable);
+
+    // Min-heap of plain ints pops in ascending order
+    IntVec *heap = IntVecNew(0);
+    TEST_ASSERT(heap != NULL);
+
+    if (heap) {
+        for (size_t i = 0; i < BIG_ARR_LEN; ++i) TEST_ASSERT(IntVecHeapPush(heap, payloads[i].important_value));
+
+        size_t out_of_order = 0;
+        int prev = *IntVecHeapPeek(heap);
+        int cur = 0;
+        while (IntVecHeapPop(heap, &cur)) {
+            if (cur < prev) out_of_order++;
+            prev = cur;
+        }
+        TEST_ASSERT_EQ_SIZE(0u, out_of_order);
+        TEST_ASSERT(IntVecHeapPeek(heap) == NULL);
+        TEST_ASSERT(!IntVecPop(heap, NULL));
+
+        // Heap-only expansion
+        IntHeap *bare = IntHeapNew(0);
+        TEST_ASSERT(bare != NULL);
+        if (bare) {
+            for (int v = 9; v >= 0; --v) TEST_ASSERT(IntHeapHeapPush(bare, (v * 7) % 10));
+
+            int expected = 0;
+            int popped = -1;
+            bool ascending = true;
+            while (IntHeapHeapPop(bare, &popped)) ascending = ascending && popped == expected++;
+            TEST_ASSERT(ascending && expected == 10);
+
+            IntHeapFree(bare);
+        }
+
+        // Heapify in place, then the root is the minimum
+        for (int v = 20; v > 0; --v) IntVecPush(heap, v);
+        IntVecHeapify(heap);
+        TEST_ASSERT_EQ_INT(1, *IntVecHeapPeek(heap));
+
+        // Three distinct keys: equal-key skipping keeps the sort O(n log n)
+        while (IntVecPop(heap, NULL)) {}
+        for (size_t i = 0; i < BIG_ARR_LEN; ++i) IntVecPush(heap, payloads[i].important_value % 3);
+        IntVecSort(heap);
+
+        size_t unordered = 0;
+        for (size_t i = 1; i < BIG_ARR_LEN; ++i) unordered += heap->data[i] < heap->data[i - 1];
+        TEST_ASSERT_EQ_SIZE(0u, unordered);
+    }
+
+    IntVecFree(heap);
+    free(payloads);
+}
+
+// ======================================================
+// Selection / top-k tests
+// ======================================================
+
+static void test_array_select(void) {
+    DummyPayload *payloads = build_big_payloads();
+    TEST_ASSERT(payloads != NULL);
+    if (!payloads) return;
+
+    Array *sorted = build_big_array(payloads);
+    TEST_ASSERT(sorted != NULL);
+    if (!sorted) {
+        free(payloads);
+        return;
+    }
+    arrayIntroSort(sorted, key_dummy_payload);
+
+    // Small k (heap pass), large k (select + sort), both ends, out of range
+    const size_t ks[] = { 0, 1, 10, BIG_ARR_LEN / 2, BIG_ARR_LEN - 1, BIG_ARR_LEN + 5 };
+
+    for (size_t t = 0; t < sizeof(ks) / sizeof(ks[0]); ++t) {
+        const size_t k = ks[t];
+        const size_t kept = k < BIG_ARR_LEN ? k : BIG_ARR_LEN;
+
+        Array *a = build_big_array(payloads);
+        TEST_ASSERT(a != NULL);
+        if (!a) continue;
+
+        void *kth = arraySelectKth(a, k, key_dummy_payload);
+
+        if (k >= BIG_ARR_LEN) {
+            TEST_ASSERT(kth == NULL);
+        } else {
+            const int kth_key = key_dummy_payload(arrayGet(sorted, k));
+            TEST_ASSERT(kth != NULL && key_dummy_payload(kth) == kth_key);
+
+            size_t misplaced = 0;
+            for (size_t i = 0; i < BIG_ARR_LEN; ++i) {
+                const int cur = key_dummy_payload(arrayGet(a, i));
+                if ((i < k && cur > kth_key) || (i > k && cur < kth_key)) misplaced++;
+            }
+            TEST_ASSERT_EQ_SIZE(0u, misplaced);
+        }
+
+        arrayPartialSort(a, k, key_dummy_payload);
+
+        Array *top = arrayTopK(a, k, key_dummy_payload);
+        TEST_ASSERT(top != NULL);
+        if (top) TEST_ASSERT_EQ_SIZE(kept, arrayLength(top));
+
+        size_t wrong = 0;
+        for (size_t i = 0; i < kept; ++i) {
+            const int expected = key_dummy_payload(arrayGet(sorted, i));
+            if (key_dummy_payload(arrayGet(a, i)) != expected) wrong++;
+            if (top && key_dummy_payload(arrayGet(top, i)) != expected) wrong++;
+        }
+        TEST_ASSERT_EQ_SIZE(0u, wrong);
+
+        arrayFree(top);
+        arrayFree(a);
+    }
+
+    arrayFree(sorted);
+    free(payloads);
+}
+
+// ======================================================
+// Operation counters (BDS_STATS)
+// ======================================================
+
+static void test_array_stats(void) {
+    Array *a = build_int_array_32();
+    TEST_ASSERT(a != NULL);
+    if (!a) return;
+
+    bdsStatsReset();
+    arrayIntroSort(a, key_int);  // 32 > leaf size: partitions with compares and swaps
+
+    const BdsStats stats = bdsStatsSnapshot();
+
+    if (bdsStatsEnabled()) {
+        TEST_ASSERT(stats.compares > 0);
+        TEST_ASSERT(stats.swaps > 0);
+        TEST_ASSERT(stats.key_calls > 0);
+        TEST_ASSERT(stats.writes >= 2 * stats.swaps);  // every swap is two arraySet, plus the leaves' stores
+    } else {
+        TEST_ASSERT_EQ_SIZE(0u, stats.compares + stats.key_calls + stats.swaps + stats.writes + stats.allocs);
+    }
+
+    // Keyed kernels compare cached keys: counted too, with one key() call per element
+    Array *keyed = build_int_array_32();
+    TEST_ASSERT(keyed != NULL);
+
+    if (keyed) {
+        bdsStatsReset();
+        arrayPdqSort(keyed, key_int);
+
+        const BdsStats keyed_stats = bdsStatsSnapshot();
+
+        if (bdsStatsEnabled()) {
+            TEST_ASSERT_EQ_SIZE(arrayLength(keyed), keyed_stats.key_calls);
+            TEST_ASSERT(keyed_stats.compares > 0);
+            TEST_ASSERT(keyed_stats.writes >= arrayLength(keyed));  // at least the write-back
+        }
+
+        assert_array_sorted_by_key(keyed, key_int);
+        arrayFree(keyed);
+    }
+
+    bdsStatsReset();
+    TEST_ASSERT_EQ_SIZE(0u, bdsStatsSnapshot().swaps);
+
+    arrayFree(a);
 }
 
 // ======================================================
@@ -565,9 +1716,24 @@ int main(void) {
     test_array_set_get();
     test_array_shallow_copy();
     test_array_find_and_count();
+    test_array_binary_search();
     test_array_free_with_deleter();
     test_array_sort_inplace();
     test_array_sort_new_arrays();
+    test_array_sort_cached();
+    test_array_sort_context();
+    test_array_parallel_sort();
+    test_array_parallel_find();
+    test_array_pipe();
+    test_array_view();
+    test_array_sort_few_distinct_keys();
+    test_array_block_merge_sort();
+    test_array_external_sort();
+    test_array_map();
+    test_array_adaptive_sort();
+    test_array_template();
+    test_array_select();
+    test_array_stats();
 
     printf("Tests run:    %d\n", g_tests_run);
     printf("Tests failed: %d\n", g_tests_failed);
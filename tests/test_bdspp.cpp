@@ -0,0 +1,230 @@
+#include "../include/bds++/bds.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <vector>
+
+// ======================================================
+// Mini test framework (same output as the C tests)
+// ======================================================
+
+static int g_tests_run    = 0;
+static int g_tests_failed = 0;
+
+#define TEST_ASSERT(cond)                                                   \
+    do {                                                                    \
+        g_tests_run++;                                                      \
+        if (!(cond)) {                                                      \
+            g_tests_failed++;                                               \
+            std::fprintf(stderr, "FAIL: %s:%d: %s\n",                       \
+                         __FILE__, __LINE__, #cond);                        \
+        }                                                                   \
+    } while (0)
+
+// ======================================================
+// Test data
+// ======================================================
+
+struct Record {
+    int key;
+    int seq;  // original position, to check stability
+};
+
+static constexpr std::size_t BIG_LEN = 50000;
+
+static std::vector<int> random_ints(const std::size_t n, const unsigned int modulo) {
+    std::vector<int> values(n);
+    unsigned int state = 12345u;
+
+    for (int &value : values) {
+        state = state * 1103515245u + 12345u;
+        value = static_cast<int>((state >> 8) % modulo) - static_cast<int>(modulo / 2);
+    }
+
+    return values;
+}
+
+static const auto record_key = bds::by_key([](const Record &r) { return r.key; });
+
+// ======================================================
+// Algorithm tests
+// ======================================================
+
+static void test_sort_matches_std(void) {
+    // Wide keys, many duplicates, three keys: every partition path
+    for (const unsigned int modulo : { 1u << 30, 2001u, 3u }) {
+        std::vector<int> expected = random_ints(BIG_LEN, modulo);
+        bds::array<int> values;
+        for (const int value : expected) values.push_back(value);
+
+        std::sort(expected.begin(), expected.end());
+        values.sort();
+        TEST_ASSERT(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+
+        // Descending, through a comparator
+        values.sort(std::greater<>());
+        TEST_ASSERT(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+
+        bds::heap_sort(values.begin(), values.end());
+        TEST_ASSERT(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+    }
+
+    // Non-trivial elements take the branchy paths; std containers work too
+    std::vector<std::string> words;
+    for (const int value : random_ints(2000, 500)) words.push_back(std::to_string(value));
+
+    std::vector<std::string> expected = words;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<std::string> unstable = words;
+    bds::sort(unstable.begin(), unstable.end());
+    TEST_ASSERT(unstable == expected);
+
+    bds::stable_sort(words.begin(), words.end());
+    TEST_ASSERT(words == expected);
+}
+
+static void test_stable_sort(void) {
+    const std::vector<int> keys = random_ints(BIG_LEN, 2001);
+
+    bds::array<Record> records;
+    for (std::size_t i = 0; i < keys.size(); ++i) records.push_back({ keys[i], static_cast<int>(i) });
+
+    bds::array<Record> copy = records;
+    TEST_ASSERT(copy.size() == records.size());
+
+    records.stable_sort(record_key);
+
+    bool stable = true;
+    for (std::size_t i = 1; i < records.size(); ++i) {
+        if (records[i].key < records[i - 1].key) stable = false;
+        if (records[i].key == records[i - 1].key && records[i].seq < records[i - 1].seq) stable = false;
+    }
+    TEST_ASSERT(stable);
+
+    // The copy was not touched, and moving leaves the source empty
+    bds::array<Record> moved = std::move(copy);
+    TEST_ASSERT(moved.size() == BIG_LEN && copy.empty());
+    TEST_ASSERT(moved[0].seq == 0);
+}
+
+static void test_bounds(void) {
+    std::vector<int> values = random_ints(BIG_LEN, 2001);
+    bds::sort(values.begin(), values.end());
+
+    bool agree = true;
+    for (int target = -1002; target <= 1002; target += 3) {
+        if (bds::lower_bound(values.begin(), values.end(), target) != std::lower_bound(values.begin(), values.end(), target)) agree = false;
+        if (bds::upper_bound(values.begin(), values.end(), target) != std::upper_bound(values.begin(), values.end(), target)) agree = false;
+    }
+    TEST_ASSERT(agree);
+
+    const std::vector<int> none;
+    TEST_ASSERT(bds::lower_bound(none.begin(), none.end(), 1) == none.end());
+}
+
+// ======================================================
+// Container tests
+// ======================================================
+
+static void test_heap(void) {
+    const std::vector<int> values = random_ints(BIG_LEN, 1u << 20);
+
+    bds::heap<int> heap;
+    std::priority_queue<int> reference;
+    for (const int value : values) {
+        heap.push(value);
+        reference.push(value);
+    }
+
+    bool same = heap.size() == reference.size();
+    while (!reference.empty()) {
+        if (heap.top() != reference.top()) same = false;
+        heap.pop();
+        reference.pop();
+    }
+    TEST_ASSERT(same && heap.empty());
+
+    // Range constructor, min-heap through the comparator
+    bds::heap<int, std::greater<int>> min_heap(values.begin(), values.end());
+    TEST_ASSERT(min_heap.top() == *std::min_element(values.begin(), values.end()));
+
+    // Move-only elements
+    const auto by_pointee = [](const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) { return *a < *b; };
+    bds::heap<std::unique_ptr<int>, decltype(by_pointee)> owners(by_pointee);
+    for (int i = 0; i < 100; ++i) owners.emplace(std::make_unique<int>((i * 37) % 100));
+
+    bool descending = true;
+    int previous = 100;
+    while (!owners.empty()) {
+        std::unique_ptr<int> top = owners.pop_top();
+        if (*top > previous) descending = false;
+        previous = *top;
+    }
+    TEST_ASSERT(descending);
+}
+
+static void test_list(void) {
+    const std::vector<int> keys = random_ints(BIG_LEN, 2001);
+
+    bds::list<Record> records;
+    for (std::size_t i = 0; i < keys.size(); ++i) records.push_back({ keys[i], static_cast<int>(i) });
+    records.push_front({ -5000, -1 });
+    TEST_ASSERT(records.size() == BIG_LEN + 1);
+    TEST_ASSERT(records.front().seq == -1 && records.back().seq == static_cast<int>(BIG_LEN) - 1);
+
+    records.sort(record_key);
+
+    bool stable = true;
+    const Record *previous = nullptr;
+    for (const Record &record : records) {
+        if (previous && record.key < previous->key) stable = false;
+        if (previous && record.key == previous->key && record.seq < previous->seq) stable = false;
+        previous = &record;
+    }
+    TEST_ASSERT(stable);
+    TEST_ASSERT(previous == &records.back());  // tail relinked
+
+    // Works with std algorithms; back() after sort stays consistent with push_back
+    records.push_back({ 5000, 0 });
+    TEST_ASSERT(std::count_if(records.begin(), records.end(), [](const Record &r) { return r.key == 5000; }) == 1);
+
+    bds::list<int> ints = { 3, 1, 2 };
+    bds::list<int> copy = ints;
+    ints.sort();
+    TEST_ASSERT(std::accumulate(ints.begin(), ints.end(), 0) == 6 && ints.front() == 1 && copy.front() == 3);
+
+    ints.pop_front();
+    ints.pop_front();
+    ints.pop_front();
+    TEST_ASSERT(ints.empty() && ints.begin() == ints.end());
+}
+
+// ======================================================
+// main
+// ======================================================
+
+int main(void) {
+    std::printf("==> Running bds++ tests\n");
+
+    test_sort_matches_std();
+    test_stable_sort();
+    test_bounds();
+    test_heap();
+    test_list();
+
+    std::printf("Tests run:    %d\n", g_tests_run);
+    std::printf("Tests failed: %d\n", g_tests_failed);
+
+    if (g_tests_failed == 0) {
+        std::printf("All tests PASSED.\n");
+        return 0;
+    }
+
+    std::printf("Some tests FAILED.\n");
+    return 1;
+}